@@ -290,6 +290,12 @@ public:
     {
     }
 
+    bool IsInvalidated(int32_t left, int32_t top, int32_t right, int32_t bottom) override
+    {
+        // Not applicable for this engine
+        return false;
+    }
+
     void BeginDraw() override
     {
         assert(_screenFramebuffer != nullptr);
@@ -380,6 +386,12 @@ public:
         _drawingContext->GetTextureCache()->InvalidateImage(image);
     }
 
+    DrawingRepaintStats GetRepaintStats() override
+    {
+        // Not applicable for this engine
+        return {};
+    }
+
     DrawPixelInfo* GetDPI()
     {
         return &_bitsDPI;
@@ -128,8 +128,8 @@ namespace OpenRCT2::Ui::Windows
         {
             widgets = _scenarioSelectWidgets;
 
-            // Load scenario list
-            ScenarioRepositoryScan();
+            // Show the scenarios found so far and pick up added or changed files once the rescan finishes
+            ScenarioRepositoryScanInBackground();
 
             _highlightedScenario = nullptr;
             InitTabs();
@@ -137,6 +137,19 @@ namespace OpenRCT2::Ui::Windows
             InitScrollWidgets();
         }
 
+        void OnUpdate() override
+        {
+            if (ScenarioRepositoryApplyBackgroundScan())
+            {
+                // The previous entries are gone, so nothing may point to them any more
+                _highlightedScenario = nullptr;
+                InitTabs();
+                InitialiseListItems();
+                InitScrollWidgets();
+                Invalidate();
+            }
+        }
+
         void OnMouseUp(WidgetIndex widgetIndex) override
         {
             if (widgetIndex == WIDX_CLOSE)
@@ -34,6 +34,7 @@
 #include "core/FileStream.h"
 #include "core/Guard.hpp"
 #include "core/Http.h"
+#include "core/JobScheduler.h"
 #include "core/MemoryStream.h"
 #include "core/Path.hpp"
 #include "core/String.hpp"
@@ -60,6 +61,7 @@
 #include "platform/Crash.h"
 #include "platform/Platform.h"
 #include "profiling/Profiling.h"
+#include "profiling/StartupTrace.h"
 #include "rct2/RCT2.h"
 #include "ride/TrackData.h"
 #include "ride/TrackDesignRepository.h"
@@ -83,6 +85,7 @@
 #include <future>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <string>
 
 using namespace OpenRCT2;
@@ -161,6 +164,7 @@ namespace OpenRCT2
         // We keep track of this to perform certain operations differently.
         std::thread::id _mainThreadId{};
         Timer _forcedUpdateTimer;
+        std::mutex _progressMutex;
 
     public:
         // Singleton of Context.
@@ -202,6 +206,8 @@ namespace OpenRCT2
             // NOTE: We must shutdown all systems here before Instance is set back to null.
             //       If objects use GetContext() in their destructor things won't go well.
 
+            ScenarioFlushPendingSaves();
+
 #ifdef ENABLE_SCRIPTING
             _scriptEngine.StopUnloadRegisterAllPlugins();
 #endif
@@ -411,8 +417,12 @@ namespace OpenRCT2
             }
             _initialised = true;
 
+            StartupTrace::Scope traceScope("Context::Initialise");
+
             CrashInit();
 
+            JobScheduler::Get().SetThreadCount(std::max(0, Config::Get().general.WorkerThreads));
+
             if (String::Equals(Config::Get().general.LastRunVersion, OPENRCT2_VERSION))
             {
                 gOpenRCT2ShowChangelog = false;
@@ -426,6 +436,7 @@ namespace OpenRCT2
 
             try
             {
+                StartupTrace::Scope languageScope("Open language");
                 _localisationService->OpenLanguage(Config::Get().general.Language);
             }
             catch (const std::exception& e)
@@ -499,6 +510,7 @@ namespace OpenRCT2
 
             if (!gOpenRCT2Headless)
             {
+                StartupTrace::Scope windowScope("Create window");
                 _uiContext->CreateWindow();
             }
 
@@ -506,6 +518,7 @@ namespace OpenRCT2
 
             if (!gOpenRCT2Headless)
             {
+                StartupTrace::Scope audioScope("Initialise audio");
                 Audio::Init();
                 Audio::PopulateDevices();
                 Audio::InitRideSoundsAndInfo();
@@ -533,13 +546,28 @@ namespace OpenRCT2
                 auto* preloaderScene = static_cast<PreloaderScene*>(GetPreloaderScene());
                 SetActiveScene(preloaderScene);
 
-                // TODO: preload the title scene in another (parallel) job.
-                preloaderScene->AddJob([this]() { InitialiseRepositories(); });
-                preloaderScene->AddJob([this]() { InitialiseScriptEngine(); });
+                // Scenarios and title sequences do not use objects, the scenario index only reads the header chunks
+                // of each file and never its packed objects. Both are scanned alongside the stages that do. Track
+                // designs may load vehicle objects to convert their ride type, which allocates images and must not
+                // overlap the asset packs reloading object images.
+                auto objects = preloaderScene->AddJob("Object repository", [this]() { LoadObjectRepository(); });
+                auto audio = preloaderScene->AddJob("Audio objects", [this]() { LoadAudioObjects(); }, { objects });
+                auto assetPacks = preloaderScene->AddJob("Asset packs", [this]() { LoadAssetPacks(); }, { audio });
+                auto trackDesigns = preloaderScene->AddJob(
+                    "Track design repository", [this]() { ScanTrackDesigns(); }, { assetPacks });
+                auto scenarios = preloaderScene->AddJob("Scenario repository", [this]() { ScanScenarios(); });
+                auto titleSequences = preloaderScene->AddJob("Title sequences", [this]() { ScanTitleSequences(); });
+                preloaderScene->AddJob(
+                    "Script engine", [this]() { InitialiseScriptEngine(); }, { trackDesigns, scenarios, titleSequences });
             }
             else
             {
-                InitialiseRepositories();
+                StartupTrace::Scope repositoriesScope("Repositories");
+                LoadObjectRepository();
+                LoadAudioObjects();
+                ScanTrackDesigns();
+                ScanScenarios();
+                ScanTitleSequences();
                 InitialiseScriptEngine();
             }
 
@@ -547,39 +575,42 @@ namespace OpenRCT2
         }
 
     private:
-        void InitialiseRepositories()
+        void LoadObjectRepository()
         {
-            if (!_initialised)
-            {
-                throw std::runtime_error("Context needs to be initialised first.");
-            }
-
-            auto currentLanguage = _localisationService->GetCurrentLanguage();
-
             OpenProgress(STR_CHECKING_OBJECT_FILES);
-            _objectRepository->LoadOrConstruct(currentLanguage);
+            _objectRepository->LoadOrConstruct(_localisationService->GetCurrentLanguage());
+        }
 
+        void LoadAudioObjects()
+        {
             OpenProgress(STR_LOADING_GENERIC);
             Audio::LoadAudioObjects();
+        }
 
-            if (!gOpenRCT2Headless)
-            {
-                OpenProgress(STR_CHECKING_ASSET_PACKS);
-                _assetPackManager->Scan();
-                _assetPackManager->LoadEnabledAssetPacks();
-                _assetPackManager->Reload();
-            }
+        void LoadAssetPacks()
+        {
+            OpenProgress(STR_CHECKING_ASSET_PACKS);
+            _assetPackManager->Scan();
+            _assetPackManager->LoadEnabledAssetPacks();
+            _assetPackManager->Reload();
+        }
 
+        void ScanTrackDesigns()
+        {
             OpenProgress(STR_CHECKING_TRACK_DESIGN_FILES);
-            _trackDesignRepository->Scan(currentLanguage);
+            _trackDesignRepository->Scan(_localisationService->GetCurrentLanguage());
+        }
 
+        void ScanScenarios()
+        {
             OpenProgress(STR_CHECKING_SCENARIO_FILES);
-            _scenarioRepository->Scan(currentLanguage);
+            _scenarioRepository->Scan(_localisationService->GetCurrentLanguage());
+        }
 
+        void ScanTitleSequences()
+        {
             OpenProgress(STR_CHECKING_TITLE_SEQUENCES);
             TitleSequenceManager::Scan();
-
-            OpenProgress(STR_LOADING_GENERIC);
         }
 
         void InitialiseScriptEngine()
@@ -664,21 +695,27 @@ namespace OpenRCT2
             auto captionString = _localisationService->GetString(captionStringId);
             auto intent = Intent(INTENT_ACTION_PROGRESS_OPEN);
             intent.PutExtra(INTENT_EXTRA_MESSAGE, captionString);
+
+            std::lock_guard<std::mutex> lock(_progressMutex);
             ContextOpenIntent(&intent);
         }
 
         void SetProgress(uint32_t currentProgress, uint32_t totalCount, StringId format = STR_NONE) override
         {
-            if (_forcedUpdateTimer.GetElapsedTime() < kForcedUpdateInterval)
-                return;
-
-            _forcedUpdateTimer.Restart();
-
-            auto intent = Intent(INTENT_ACTION_PROGRESS_SET);
-            intent.PutExtra(INTENT_EXTRA_PROGRESS_OFFSET, currentProgress);
-            intent.PutExtra(INTENT_EXTRA_PROGRESS_TOTAL, totalCount);
-            intent.PutExtra(INTENT_EXTRA_STRING_ID, format);
-            ContextOpenIntent(&intent);
+            {
+                // Preloader stages report progress from several job threads at once.
+                std::lock_guard<std::mutex> lock(_progressMutex);
+                if (_forcedUpdateTimer.GetElapsedTime() < kForcedUpdateInterval)
+                    return;
+
+                _forcedUpdateTimer.Restart();
+
+                auto intent = Intent(INTENT_ACTION_PROGRESS_SET);
+                intent.PutExtra(INTENT_EXTRA_PROGRESS_OFFSET, currentProgress);
+                intent.PutExtra(INTENT_EXTRA_PROGRESS_TOTAL, totalCount);
+                intent.PutExtra(INTENT_EXTRA_STRING_ID, format);
+                ContextOpenIntent(&intent);
+            }
 
             // When we call this from the main thread we can pump messages and redraw.
             const auto isMainThread = _mainThreadId == std::this_thread::get_id();
@@ -694,6 +731,8 @@ namespace OpenRCT2
         void CloseProgress() override
         {
             auto intent = Intent(INTENT_ACTION_PROGRESS_CLOSE);
+
+            std::lock_guard<std::mutex> lock(_progressMutex);
             ContextOpenIntent(&intent);
         }
 
@@ -1009,6 +1048,7 @@ namespace OpenRCT2
 
         bool LoadBaseGraphics()
         {
+            StartupTrace::Scope traceScope("Load base graphics");
             if (!GfxLoadG1(*_env))
             {
                 return false;
@@ -1021,6 +1061,8 @@ namespace OpenRCT2
 
         void SwitchToStartUpScene()
         {
+            StartupTrace::Scope traceScope("Start up scene");
+
             if (gOpenRCT2Headless)
             {
                 // NONE or OPEN are the only allowed actions for headless mode
@@ -1193,11 +1235,15 @@ namespace OpenRCT2
 
             if (!gOpenRCT2Headless)
             {
-                _preloaderScene->SetOnComplete([&]() { SwitchToStartUpScene(); });
+                _preloaderScene->SetOnComplete([&]() {
+                    SwitchToStartUpScene();
+                    StartupTrace::Finish();
+                });
             }
             else
             {
                 SwitchToStartUpScene();
+                StartupTrace::Finish();
             }
 
             _stdInOutConsole.Start();
@@ -1272,6 +1318,9 @@ namespace OpenRCT2
 
             UpdateTimeAccumulators(deltaTime);
 
+            ScenarioUpdatePendingSaves();
+            GfxObjectUpdateImageCache();
+
             if (useVariableFrame)
             {
                 RunVariableFrame(deltaTime);
@@ -602,8 +602,10 @@ void GameAutosave()
 
     auto& gameState = GetGameState();
 
-    if (!ScenarioSave(gameState, path, saveFlags))
-        Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
+    ScenarioSaveAsync(gameState, path, saveFlags, [](bool success) {
+        if (!success)
+            Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
+    });
 }
 
 static void GameLoadOrQuitNoSavePromptCallback(int32_t result, const utf8* path)
@@ -57,6 +57,12 @@ public:
         OpenRCT2::IStream* stream, bool isScenario, bool skipObjectCheck = false, const u8string& path = {})
         = 0;
 
+    /**
+     * Reads only what GetDetails needs from a scenario. Objects are neither resolved nor exported and the map is not
+     * read, which makes this suitable for indexing scenarios.
+     */
+    virtual void LoadScenarioDetails(const u8string& path) = 0;
+
     virtual void Import(OpenRCT2::GameState_t& gameState) = 0;
     virtual bool GetDetails(ScenarioIndexEntry* dst) = 0;
 };
@@ -38,6 +38,7 @@
 #include "world/Park.h"
 #include "zlib.h"
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <vector>
@@ -81,6 +82,13 @@ namespace OpenRCT2
         OpenRCT2::MemoryStream data;
     };
 
+    struct ReplayKeyframe
+    {
+        uint32_t tick = 0;
+        OpenRCT2::MemoryStream parkData;
+        OpenRCT2::MemoryStream parkParams;
+    };
+
     struct ReplayRecordData
     {
         uint32_t magic;
@@ -95,14 +103,20 @@ namespace OpenRCT2
         uint32_t tickStart;    // First tick of replay.
         uint32_t tickEnd;      // Last tick of replay.
         std::multiset<ReplayCommand> commands;
+        std::multiset<ReplayCommand>::const_iterator nextCommand; // Next command to replay during playback.
         std::vector<std::pair<uint32_t, EntitiesChecksum>> checksums;
         uint32_t checksumIndex;
         OpenRCT2::MemoryStream gameStateSnapshots;
+        std::vector<ReplayKeyframe> keyframes; // Park states captured during recording, ordered by tick.
     };
 
     class ReplayManager final : public IReplayManager
     {
-        static constexpr uint16_t kReplayVersion = 10;
+        static constexpr uint16_t kReplayVersion = 12;
+        // Replays before this version stored checksums of a full walk over all entities.
+        static constexpr uint16_t kReplayVersionIncrementalChecksum = 11;
+        // Replays before this version have no keyframes and can only be played from the start.
+        static constexpr uint16_t kReplayVersionKeyframes = 12;
         static constexpr uint32_t kReplayMagic = 0x5243524F; // ORCR.
         static constexpr int kReplayCompressionLevel = 9;
         static constexpr int kNormalRecordingChecksumTicks = 1;
@@ -156,6 +170,13 @@ namespace OpenRCT2
             _currentRecording->checksums.emplace_back(std::make_pair(tick, std::move(checksum)));
         }
 
+        void AddKeyframe(uint32_t tick)
+        {
+            auto& keyframe = _currentRecording->keyframes.emplace_back();
+            keyframe.tick = tick;
+            ExportPark(keyframe.parkData, keyframe.parkParams);
+        }
+
         // Function runs each Tick.
         virtual void Update() override
         {
@@ -172,6 +193,15 @@ namespace OpenRCT2
                 _nextChecksumTick = currentTicks + ChecksumTicksDelta();
             }
 
+            // Keyframes are taken before any command of this tick is executed so that seeking can
+            // restore the park and replay the commands from this tick onwards.
+            if ((_mode == ReplayMode::RECORDING || _mode == ReplayMode::NORMALISATION) && currentTicks == _nextKeyframeTick)
+            {
+                AddKeyframe(currentTicks);
+
+                _nextKeyframeTick = currentTicks + _keyframeTicks;
+            }
+
             if (_mode == ReplayMode::RECORDING)
             {
                 if (currentTicks >= _currentRecording->tickEnd)
@@ -204,7 +234,7 @@ namespace OpenRCT2
                 ReplayCommands();
 
                 // If we run out of commands we can just stop
-                if (_currentReplay->commands.empty())
+                if (_currentReplay->nextCommand == _currentReplay->commands.end())
                 {
                     StopPlayback();
                     StopRecording();
@@ -228,7 +258,8 @@ namespace OpenRCT2
         }
 
         virtual bool StartRecording(
-            const std::string& name, uint32_t maxTicks /*= k_MaxReplayTicks*/, RecordType rt /*= RecordType::NORMAL*/) override
+            const std::string& name, uint32_t maxTicks /*= k_MaxReplayTicks*/, RecordType rt /*= RecordType::NORMAL*/,
+            uint32_t keyframeTicks /*= k_ReplayKeyframeTicks*/) override
         {
             // If using silent recording, discard whatever recording there is going on, even if a new silent recording is to be
             // started.
@@ -254,19 +285,10 @@ namespace OpenRCT2
 
             replayData->filePath = name;
 
-            auto context = GetContext();
-            auto& objManager = context->GetObjectManager();
-            auto objects = objManager.GetPackableObjects();
-
-            auto exporter = std::make_unique<ParkFileExporter>();
-            exporter->ExportObjectsList = objects;
-            exporter->Export(gameState, replayData->parkData);
+            ExportPark(replayData->parkData, replayData->parkParams);
 
             replayData->timeRecorded = std::chrono::seconds(std::time(nullptr)).count();
 
-            DataSerialiser parkParamsDs(true, replayData->parkParams);
-            SerialiseParkParameters(parkParamsDs);
-
             DataSerialiser cheatDataDs(true, replayData->cheatData);
             SerialiseCheats(cheatDataDs);
 
@@ -278,6 +300,8 @@ namespace OpenRCT2
             _currentRecording = std::move(replayData);
             _recordType = rt;
             _nextChecksumTick = currentTicks + 1;
+            _keyframeTicks = std::max<uint32_t>(keyframeTicks, 1);
+            _nextKeyframeTick = currentTicks + _keyframeTicks;
 
             return true;
         }
@@ -384,6 +408,7 @@ namespace OpenRCT2
                 info.Ticks = data->tickEnd - data->tickStart;
             info.NumCommands = static_cast<uint32_t>(data->commands.size());
             info.NumChecksums = static_cast<uint32_t>(data->checksums.size());
+            info.NumKeyframes = static_cast<uint32_t>(data->keyframes.size());
 
             return true;
         }
@@ -442,7 +467,7 @@ namespace OpenRCT2
                 return false;
             }
 
-            if (!LoadReplayDataMap(*replayData))
+            if (!LoadReplayPark(replayData->parkData, replayData->parkParams))
             {
                 LOG_ERROR("Unable to load map.");
                 return false;
@@ -453,6 +478,7 @@ namespace OpenRCT2
             LoadAndCompareSnapshot(replayData->gameStateSnapshots);
 
             _currentReplay = std::move(replayData);
+            _currentReplay->nextCommand = _currentReplay->commands.begin();
             _currentReplay->checksumIndex = 0;
             _faultyChecksumIndex = -1;
 
@@ -470,6 +496,68 @@ namespace OpenRCT2
             return _faultyChecksumIndex != -1;
         }
 
+        virtual bool SeekToTick(uint32_t replayTick) override
+        {
+            if (_mode != ReplayMode::PLAYING)
+                return false;
+
+            const uint32_t tickStart = _currentReplay->tickStart;
+            const uint32_t tickEnd = _currentReplay->tickEnd;
+            if (replayTick >= tickEnd - tickStart)
+            {
+                LOG_ERROR("Seek tick %u is past the end of the replay (%u ticks).", replayTick, tickEnd - tickStart);
+                return false;
+            }
+
+            const uint32_t targetTick = tickStart + replayTick;
+            uint32_t currentTicks = GetGameState().CurrentTicks;
+
+            // Find the closest keyframe at or before the target, the start of the replay counts as one.
+            auto& keyframes = _currentReplay->keyframes;
+            auto it = std::upper_bound(
+                keyframes.begin(), keyframes.end(), targetTick,
+                [](uint32_t tick, const ReplayKeyframe& keyframe) { return tick < keyframe.tick; });
+            ReplayKeyframe* keyframe = it != keyframes.begin() ? &*std::prev(it) : nullptr;
+            const uint32_t keyframeTick = keyframe != nullptr ? keyframe->tick : tickStart;
+
+            // Only restore a keyframe when going backwards or when it skips ticks we would otherwise simulate.
+            if (targetTick < currentTicks || keyframeTick > currentTicks)
+            {
+                bool loaded = keyframe != nullptr ? LoadReplayPark(keyframe->parkData, keyframe->parkParams)
+                                                  : LoadReplayPark(_currentReplay->parkData, _currentReplay->parkParams);
+                if (!loaded)
+                {
+                    LOG_ERROR("Unable to load keyframe at tick %u.", keyframeTick);
+                    StopPlayback();
+                    return false;
+                }
+
+                currentTicks = keyframeTick;
+                GetGameState().CurrentTicks = currentTicks;
+
+                auto& commands = _currentReplay->commands;
+                _currentReplay->nextCommand = std::find_if(
+                    commands.begin(), commands.end(), [&](const ReplayCommand& command) { return command.tick >= currentTicks; });
+
+                const auto& checksums = _currentReplay->checksums;
+                auto checksumIt = std::find_if(checksums.begin(), checksums.end(), [&](const auto& checksum) {
+                    return checksum.first >= currentTicks;
+                });
+                _currentReplay->checksumIndex = static_cast<uint32_t>(std::distance(checksums.begin(), checksumIt));
+                _faultyChecksumIndex = -1;
+
+                LOG_VERBOSE("Restored replay keyframe at tick %u", currentTicks);
+            }
+
+            // Simulate the remaining ticks up to the target, this still validates the recorded checksums.
+            while (_mode == ReplayMode::PLAYING && GetGameState().CurrentTicks < targetTick)
+            {
+                gameStateUpdateLogic();
+            }
+
+            return _mode == ReplayMode::PLAYING;
+        }
+
         virtual bool StopPlayback() override
         {
             if (_mode != ReplayMode::PLAYING && _mode != ReplayMode::NORMALISATION)
@@ -504,7 +592,7 @@ namespace OpenRCT2
                 return false;
             }
 
-            if (!StartRecording(outFile, k_MaxReplayTicks, RecordType::NORMAL))
+            if (!StartRecording(outFile, k_MaxReplayTicks, RecordType::NORMAL, k_ReplayKeyframeTicks))
             {
                 StopPlayback();
                 return false;
@@ -528,17 +616,30 @@ namespace OpenRCT2
             }
         }
 
-        bool LoadReplayDataMap(ReplayRecordData& data)
+        void ExportPark(MemoryStream& parkData, MemoryStream& parkParams)
+        {
+            auto& objManager = GetContext()->GetObjectManager();
+
+            auto exporter = std::make_unique<ParkFileExporter>();
+            exporter->ExportObjectsList = objManager.GetPackableObjects();
+            exporter->Export(GetGameState(), parkData);
+
+            DataSerialiser parkParamsDs(true, parkParams);
+            SerialiseParkParameters(parkParamsDs);
+        }
+
+        bool LoadReplayPark(MemoryStream& parkData, MemoryStream& parkParams)
         {
             try
             {
-                data.parkData.SetPosition(0);
+                parkData.SetPosition(0);
+                parkParams.SetPosition(0);
 
                 auto context = GetContext();
                 auto& objManager = context->GetObjectManager();
                 auto importer = ParkImporter::CreateParkFile(context->GetObjectRepository());
 
-                auto loadResult = importer->LoadFromStream(&data.parkData, false);
+                auto loadResult = importer->LoadFromStream(&parkData, false);
                 objManager.LoadObjects(loadResult.RequiredObjects);
 
                 // TODO: Have a separate GameState and exchange once loaded.
@@ -548,7 +649,7 @@ namespace OpenRCT2
                 EntityTweener::Get().Reset();
 
                 // Load all map global variables.
-                DataSerialiser parkParamsDs(false, data.parkParams);
+                DataSerialiser parkParamsDs(false, parkParams);
                 SerialiseParkParameters(parkParamsDs);
 
                 GameLoadInit();
@@ -723,7 +824,7 @@ namespace OpenRCT2
 
         bool Compatible(ReplayRecordData& data)
         {
-            return data.version == kReplayVersion;
+            return data.version >= kReplayVersionIncrementalChecksum - 1 && data.version <= kReplayVersion;
         }
 
         bool Serialise(DataSerialiser& serialiser, ReplayRecordData& data)
@@ -796,6 +897,24 @@ namespace OpenRCT2
             }
 
             serialiser << data.gameStateSnapshots;
+
+            if (data.version >= kReplayVersionKeyframes)
+            {
+                uint32_t countKeyframes = static_cast<uint32_t>(data.keyframes.size());
+                serialiser << countKeyframes;
+
+                if (serialiser.IsLoading())
+                {
+                    data.keyframes.resize(countKeyframes);
+                }
+
+                for (auto& keyframe : data.keyframes)
+                {
+                    serialiser << keyframe.tick;
+                    serialiser << keyframe.parkData;
+                    serialiser << keyframe.parkParams;
+                }
+            }
             return true;
         }
 
@@ -814,7 +933,9 @@ namespace OpenRCT2
             {
                 _currentReplay->checksumIndex++;
 
-                EntitiesChecksum checksum = GetAllEntitiesChecksum();
+                EntitiesChecksum checksum = _currentReplay->version < kReplayVersionIncrementalChecksum
+                    ? GetAllEntitiesChecksumLegacy()
+                    : GetAllEntitiesChecksum();
                 if (savedChecksum.second.raw != checksum.raw)
                 {
                     uint32_t replayTick = currentTicks - _currentReplay->tickStart;
@@ -843,9 +964,10 @@ namespace OpenRCT2
 
             const auto currentTicks = GetGameState().CurrentTicks;
 
-            while (replayQueue.begin() != replayQueue.end())
+            auto& nextCommand = _currentReplay->nextCommand;
+            while (nextCommand != replayQueue.end())
             {
-                const ReplayCommand& command = (*replayQueue.begin());
+                const ReplayCommand& command = *nextCommand;
 
                 if (_mode == ReplayMode::PLAYING)
                 {
@@ -881,7 +1003,7 @@ namespace OpenRCT2
                         WindowScrollToLocation(*mainWindow, result.Position);
                 }
 
-                replayQueue.erase(replayQueue.begin());
+                ++nextCommand;
             }
         }
 
@@ -892,6 +1014,8 @@ namespace OpenRCT2
         int32_t _faultyChecksumIndex = -1;
         uint32_t _commandId = 0;
         uint32_t _nextChecksumTick = 0;
+        uint32_t _nextKeyframeTick = 0;
+        uint32_t _keyframeTicks = k_ReplayKeyframeTicks;
         uint32_t _nextReplayTick = 0;
         RecordType _recordType = RecordType::NORMAL;
     };
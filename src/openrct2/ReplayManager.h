@@ -18,6 +18,7 @@ class GameAction;
 namespace OpenRCT2
 {
     static constexpr uint32_t k_MaxReplayTicks = 0xFFFFFFFF;
+    static constexpr uint32_t k_ReplayKeyframeTicks = 40 * 60 * 10; // Ten minutes at normal game speed.
 
     struct ReplayRecordInfo
     {
@@ -26,6 +27,7 @@ namespace OpenRCT2
         uint64_t TimeRecorded;
         uint32_t NumCommands;
         uint32_t NumChecksums;
+        uint32_t NumKeyframes;
         std::string Name;
         std::string FilePath;
     };
@@ -50,14 +52,23 @@ namespace OpenRCT2
 
         virtual void AddGameAction(uint32_t tick, const GameAction* action) = 0;
 
+        /**
+         * @param keyframeTicks How often the park is stored in the recording, seeking restores the closest one.
+         */
         virtual bool StartRecording(
-            const std::string& name, uint32_t maxTicks = k_MaxReplayTicks, RecordType rt = RecordType::NORMAL)
+            const std::string& name, uint32_t maxTicks = k_MaxReplayTicks, RecordType rt = RecordType::NORMAL,
+            uint32_t keyframeTicks = k_ReplayKeyframeTicks)
             = 0;
         virtual bool StopRecording(bool discard = false) = 0;
         virtual bool GetCurrentReplayInfo(ReplayRecordInfo& info) const = 0;
 
         virtual bool StartPlayback(const std::string& file) = 0;
         virtual bool IsPlaybackStateMismatching() const = 0;
+        /**
+         * Jumps the current playback to the given tick relative to the start of the replay by restoring
+         * the closest keyframe at or before it and simulating the remaining ticks.
+         */
+        virtual bool SeekToTick(uint32_t replayTick) = 0;
         virtual bool StopPlayback() = 0;
 
         virtual bool NormaliseReplay(const std::string& inputFile, const std::string& outputFile) = 0;
@@ -22,6 +22,7 @@
 #include "../localisation/StringIds.h"
 #include "../network/network.h"
 #include "../object/PathAdditionEntry.h"
+#include "../paint/Paint.TileCache.h"
 #include "../ride/Ride.h"
 #include "../ride/Vehicle.h"
 #include "../scenario/Scenario.h"
@@ -448,6 +449,7 @@ void CheatSetAction::SetGrassLength(int32_t length) const
         }
     }
 
+    PaintTileCacheInvalidate();
     GfxInvalidateScreen();
 }
 
@@ -464,6 +466,7 @@ void CheatSetAction::WaterPlants() const
         }
     } while (TileElementIteratorNext(&it));
 
+    PaintTileCacheInvalidate();
     GfxInvalidateScreen();
 }
 
@@ -483,6 +486,7 @@ void CheatSetAction::FixVandalism() const
         it.element->AsPath()->SetIsBroken(false);
     } while (TileElementIteratorNext(&it));
 
+    PaintTileCacheInvalidate();
     GfxInvalidateScreen();
 }
 
@@ -510,6 +514,7 @@ void CheatSetAction::RemoveLitter() const
 
     } while (TileElementIteratorNext(&it));
 
+    PaintTileCacheInvalidate();
     GfxInvalidateScreen();
 }
 
@@ -631,6 +636,8 @@ void CheatSetAction::GenerateGuests(int32_t count) const
 
 void CheatSetAction::SetGuestParameter(int32_t parameter, int32_t value) const
 {
+    // Changes every guest, so all of them are re-hashed
+    InvalidateAllEntitiesChecksum();
     for (auto peep : EntityList<Guest>())
     {
         switch (parameter)
@@ -675,6 +682,7 @@ void CheatSetAction::SetGuestParameter(int32_t parameter, int32_t value) const
 
 void CheatSetAction::GiveObjectToGuests(int32_t object) const
 {
+    InvalidateAllEntitiesChecksum();
     for (auto peep : EntityList<Guest>())
     {
         switch (object)
@@ -702,6 +710,8 @@ void CheatSetAction::GiveObjectToGuests(int32_t object) const
 
 void CheatSetAction::RemoveAllGuests() const
 {
+    // Empties every train as well as removing the guests
+    InvalidateAllEntitiesChecksum();
     for (auto& ride : GetRideManager())
     {
         ride.num_riders = 0;
@@ -755,6 +765,7 @@ void CheatSetAction::RemoveAllGuests() const
 
 void CheatSetAction::SetStaffSpeed(uint8_t value) const
 {
+    InvalidateAllEntitiesChecksum();
     for (auto peep : EntityList<Staff>())
     {
         peep->Energy = value;
@@ -840,5 +851,6 @@ void CheatSetAction::RemoveParkFences() const
         }
     } while (TileElementIteratorNext(&it));
 
+    PaintTileCacheInvalidate();
     GfxInvalidateScreen();
 }
@@ -16,6 +16,7 @@
 #include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../core/MemoryStream.h"
+#include "../entity/EntityRegistry.h"
 #include "../entity/MoneyEffect.h"
 #include "../localisation/Formatter.h"
 #include "../network/network.h"
@@ -357,6 +358,7 @@ namespace OpenRCT2::GameActions
 
             // Execute the action, changing the game state
             result = action->Execute();
+            InvalidateAllEntitiesChecksum();
 #ifdef ENABLE_SCRIPTING
             if (result.Error == GameActions::Status::Ok)
             {
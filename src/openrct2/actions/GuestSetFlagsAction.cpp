@@ -61,6 +61,7 @@ GameActions::Result GuestSetFlagsAction::Execute() const
     }
 
     peep->PeepFlags = _newFlags;
+    EntityInvalidateChecksum(peep);
 
     return GameActions::Result();
 }
@@ -12,6 +12,7 @@
 #include "../Context.h"
 #include "../GameState.h"
 #include "../drawing/IDrawingEngine.h"
+#include "../paint/Paint.TileCache.h"
 #include "../ui/UiContext.h"
 #include "../ui/WindowManager.h"
 #include "../windows/Intent.h"
@@ -88,6 +89,7 @@ GameActions::Result MapChangeSizeAction::Execute() const
     OpenRCT2::Park::UpdateSize(gameState);
 
     windowManager->BroadcastIntent(Intent(INTENT_ACTION_MAP));
+    PaintTileCacheInvalidate();
     GfxInvalidateScreen();
     return GameActions::Result();
 }
@@ -14,6 +14,7 @@
 #include "../core/MemoryStream.h"
 #include "../drawing/Drawing.h"
 #include "../entity/EntityList.h"
+#include "../entity/EntityRegistry.h"
 #include "../entity/Staff.h"
 #include "../localisation/StringIds.h"
 #include "../ui/UiContext.h"
@@ -73,6 +74,7 @@ GameActions::Result StaffSetColourAction::Execute() const
         {
             peep->TshirtColour = _colour;
             peep->TrousersColour = _colour;
+            EntityInvalidateChecksum(peep);
         }
     }
 
@@ -73,6 +73,7 @@ GameActions::Result StaffSetOrdersAction::Execute() const
         return GameActions::Result(GameActions::Status::InvalidParameters, STR_ERR_INVALID_PARAMETER, STR_ERR_STAFF_NOT_FOUND);
     }
     staff->StaffOrders = _ordersId;
+    EntityInvalidateChecksum(staff);
 
     WindowInvalidateByNumber(WindowClass::Peep, _spriteIndex);
     auto intent = Intent(INTENT_ACTION_REFRESH_STAFF_LIST);
@@ -0,0 +1,217 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Version.h"
+#include "../core/Console.hpp"
+#include "../core/Imaging.h"
+#include "../core/Json.hpp"
+#include "../drawing/Drawing.h"
+#include "../drawing/ImageImporter.h"
+#include "../platform/Platform.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+struct BenchBlitOptions
+{
+    int32_t iterations = 2000;
+    u8string output;
+};
+
+static BenchBlitOptions _options;
+
+// clang-format off
+static constexpr CommandLineOptionDefinition BenchBlitOptionsDef[]
+{
+    { CMDLINE_TYPE_INTEGER, &_options.iterations, NAC, "iterations", "number of times each sprite is drawn (default 2000)"       },
+    { CMDLINE_TYPE_STRING,  &_options.output,     NAC, "output",     "write the results to the given file as Google benchmark JSON" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBenchBlit(CommandLineArgEnumerator *argEnumerator);
+
+const CommandLineCommand CommandLine::BenchBlitCommands[]
+{
+    // Main commands
+    DefineCommand("", "", BenchBlitOptionsDef, HandleBenchBlit),
+    CommandTableEnd
+};
+// clang-format on
+
+using SpriteRunFunc = void (*)(const uint8_t*, uint8_t*, int32_t, const uint8_t*);
+
+struct BenchBlitKernel
+{
+    const char* Name;
+    SpriteRunFunc Remap;
+    SpriteRunFunc Filter;
+    bool (*IsAvailable)();
+};
+
+// The per pixel path the sprite runs were drawn with before they were vectorised
+static void RemapRunBlitPixel(const uint8_t* src, uint8_t* dst, int32_t count, const uint8_t* table)
+{
+    const PaletteMap paletteMap(const_cast<uint8_t*>(table), 1, 256);
+    for (int32_t i = 0; i < count; i++)
+    {
+        BlitPixel<BLEND_TRANSPARENT | BLEND_SRC>(src + i, dst + i, paletteMap);
+    }
+}
+
+static void FilterRunBlitPixel(const uint8_t* src, uint8_t* dst, int32_t count, const uint8_t* table)
+{
+    const PaletteMap paletteMap(const_cast<uint8_t*>(table), 1, 256);
+    for (int32_t i = 0; i < count; i++)
+    {
+        BlitPixel<BLEND_TRANSPARENT | BLEND_DST>(src + i, dst + i, paletteMap);
+    }
+}
+
+static bool IsAlwaysAvailable()
+{
+    return true;
+}
+
+static const BenchBlitKernel kBenchBlitKernels[] = {
+    { "blitpixel", RemapRunBlitPixel, FilterRunBlitPixel, IsAlwaysAvailable },
+    { "scalar", RemapRunScalar, FilterRunScalar, IsAlwaysAvailable },
+    { "avx2", RemapRunAvx2, FilterRunAvx2, Platform::AVX2Available },
+};
+
+/**
+ * Creates a sprite with runs of random length between transparent gaps, like most scenery and ride sprites.
+ */
+static ImageImporter::ImportResult CreateBenchSprite(int32_t width, int32_t height, int32_t maxRunLength)
+{
+    std::mt19937 random(width * 31 + maxRunLength);
+    std::uniform_int_distribution<int32_t> runLength(1, maxRunLength);
+    std::uniform_int_distribution<int32_t> gapLength(1, 8);
+    std::uniform_int_distribution<int32_t> colour(1, 255);
+
+    Image image;
+    image.Width = width;
+    image.Height = height;
+    image.Depth = 8;
+    image.Stride = width;
+    image.Pixels.resize(static_cast<size_t>(width) * height);
+    for (int32_t y = 0; y < height; y++)
+    {
+        auto* row = &image.Pixels[static_cast<size_t>(y) * width];
+        for (int32_t x = gapLength(random); x < width; x += gapLength(random))
+        {
+            for (auto end = std::min(width, x + runLength(random)); x < end; x++)
+            {
+                row[x] = static_cast<uint8_t>(colour(random));
+            }
+        }
+    }
+
+    ImageImportMeta meta{};
+    meta.palette = Palette::KeepIndices;
+    return ImageImporter().Import(image, meta);
+}
+
+/**
+ * Calls the run function for every run of the sprite, the way DrawRLESprite walks them at zoom level 0.
+ */
+static void DrawSpriteRuns(const G1Element& sprite, uint8_t* dst, int32_t dstPitch, SpriteRunFunc func, const uint8_t* table)
+{
+    const auto* data = sprite.offset;
+    for (int32_t y = 0; y < sprite.height; y++)
+    {
+        auto* nextRun = data + (data[y * 2] | (data[y * 2 + 1] << 8));
+        auto isEndOfLine = false;
+        while (!isEndOfLine)
+        {
+            auto* src = nextRun;
+            auto dataSize = *src++;
+            auto firstPixelX = *src++;
+            isEndOfLine = (dataSize & 0x80) != 0;
+            dataSize &= 0x7F;
+            nextRun = src + dataSize;
+            func(src, dst + y * dstPitch + firstPixelX, dataSize, table);
+        }
+    }
+}
+
+static exitcode_t HandleBenchBlit([[maybe_unused]] CommandLineArgEnumerator* argEnumerator)
+{
+    if (_options.iterations < 1)
+    {
+        Console::Error::WriteLine("Usage: openrct2 bench-blit [--iterations=<n>] [--output=<json file>]");
+        return EXITCODE_FAIL;
+    }
+
+    // A table that changes every colour, so no pixel is skipped for mapping to 0
+    std::vector<uint8_t> table(256);
+    for (size_t i = 0; i < table.size(); i++)
+    {
+        table[i] = static_cast<uint8_t>(255 - (i % 255));
+    }
+
+    constexpr int32_t kSpriteSize = 128;
+    std::vector<uint8_t> dst(kSpriteSize * kSpriteSize);
+    auto benchmarks = json_t::array();
+    Console::WriteLine("%-40s %12s %12s", "Benchmark", "ns/sprite", "Mpixels/s");
+    for (const auto maxRunLength : { 8, 32, 127 })
+    {
+        const auto sprite = CreateBenchSprite(kSpriteSize, kSpriteSize, maxRunLength);
+        for (const auto& kernel : kBenchBlitKernels)
+        {
+            if (!kernel.IsAvailable())
+                continue;
+
+            for (const auto isFilter : { false, true })
+            {
+                const auto func = isFilter ? kernel.Filter : kernel.Remap;
+                const auto start = std::chrono::steady_clock::now();
+                for (int32_t i = 0; i < _options.iterations; i++)
+                {
+                    DrawSpriteRuns(sprite.Element, dst.data(), kSpriteSize, func, table.data());
+                }
+                const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+
+                const auto name = std::string(isFilter ? "filter" : "remap") + "/runs:" + std::to_string(maxRunLength) + "/"
+                    + kernel.Name;
+                const auto time = elapsed.count() / _options.iterations;
+                const auto pixelsPerSecond = kSpriteSize * kSpriteSize / time * 1000.0;
+                Console::WriteLine("%-40s %12.0f %12.1f", name.c_str(), time, pixelsPerSecond);
+                benchmarks.push_back({
+                    { "name", name },
+                    { "run_name", name },
+                    { "run_type", "iteration" },
+                    { "iterations", _options.iterations },
+                    { "real_time", time },
+                    { "cpu_time", time },
+                    { "time_unit", "ns" },
+                });
+            }
+        }
+    }
+
+    if (!_options.output.empty())
+    {
+        json_t benchContext = {
+            { "executable", "openrct2 bench-blit" },
+            { "version", std::string(gVersionInfoFull) },
+            { "sprite_size", kSpriteSize },
+        };
+        json_t root = { { "context", std::move(benchContext) }, { "benchmarks", std::move(benchmarks) } };
+        Json::WriteToFile(_options.output, root);
+        Console::WriteLine("Results written to %s", _options.output.c_str());
+    }
+    return EXITCODE_OK;
+}
@@ -0,0 +1,47 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../interface/Screenshot.h"
+#include "CommandLine.hpp"
+
+using namespace OpenRCT2;
+
+static BenchPaintOptions _options;
+
+// clang-format off
+static constexpr CommandLineOptionDefinition BenchPaintOptionsDef[]
+{
+    { CMDLINE_TYPE_INTEGER, &_options.iterations, NAC, "iterations", "number of times each camera position is painted (default 10)" },
+    { CMDLINE_TYPE_INTEGER, &_options.width,      NAC, "width",      "width of the viewport (default 1920)"                         },
+    { CMDLINE_TYPE_INTEGER, &_options.height,     NAC, "height",     "height of the viewport (default 1080)"                        },
+    { CMDLINE_TYPE_STRING,  &_options.output,     NAC, "output",     "write the results to the given file as Google benchmark JSON" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBenchPaint(CommandLineArgEnumerator *argEnumerator);
+
+const CommandLineCommand CommandLine::BenchPaintCommands[]
+{
+    // Main commands
+    DefineCommand("", "<file> [<file>...]", BenchPaintOptionsDef, HandleBenchPaint),
+    CommandTableEnd
+};
+// clang-format on
+
+static exitcode_t HandleBenchPaint(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CommandLineForBenchPaint(argv, argc, &_options);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
@@ -118,6 +118,9 @@ namespace OpenRCT2::CommandLine
     extern const CommandLineCommand SpriteCommands[];
     extern const CommandLineCommand SimulateCommands[];
     extern const CommandLineCommand ParkInfoCommands[];
+    extern const CommandLineCommand ReplayCommands[];
+    extern const CommandLineCommand BenchPaintCommands[];
+    extern const CommandLineCommand BenchBlitCommands[];
 
     extern const CommandLineExample RootExamples[];
 
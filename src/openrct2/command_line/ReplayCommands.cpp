@@ -0,0 +1,97 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../core/Console.hpp"
+#include "../entity/EntityRegistry.h"
+#include "CommandLine.hpp"
+
+#include <memory>
+
+using namespace OpenRCT2;
+
+static int32_t _seekTick = -1;
+
+// clang-format off
+static constexpr CommandLineOptionDefinition ReplayOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_seekTick, NAC, "seek", "tick to jump to before resuming playback" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleReplay(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::ReplayCommands[]
+{
+    // Main commands
+    DefineCommand("", "<replay-file>", ReplayOptions, HandleReplay),
+    CommandTableEnd
+};
+// clang-format on
+
+static exitcode_t HandleReplay(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 1)
+    {
+        Console::Error::WriteLine("Missing argument <replay-file>.");
+        return EXITCODE_FAIL;
+    }
+
+    const char* replayPath = argv[0];
+
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    auto* replayManager = context->GetReplayManager();
+    if (!replayManager->StartPlayback(replayPath))
+    {
+        Console::Error::WriteLine("Unable to start replay '%s'.", replayPath);
+        return EXITCODE_FAIL;
+    }
+
+    ReplayRecordInfo info;
+    replayManager->GetCurrentReplayInfo(info);
+    Console::WriteLine("Replaying %u ticks (%u keyframes)...", info.Ticks, info.NumKeyframes);
+
+    if (_seekTick >= 0)
+    {
+        if (!replayManager->SeekToTick(static_cast<uint32_t>(_seekTick)))
+        {
+            Console::Error::WriteLine("Unable to seek to tick %d.", _seekTick);
+            return EXITCODE_FAIL;
+        }
+        Console::WriteLine("Seeked to tick %d: %s", _seekTick, GetAllEntitiesChecksum().ToString().c_str());
+    }
+
+    while (replayManager->IsReplaying() && !replayManager->IsPlaybackStateMismatching())
+    {
+        gameStateUpdateLogic();
+    }
+
+    if (replayManager->IsPlaybackStateMismatching())
+    {
+        Console::Error::WriteLine("Replay state mismatch at tick %u.", GetGameState().CurrentTicks);
+        return EXITCODE_FAIL;
+    }
+
+    Console::WriteLine("Completed: %s", GetAllEntitiesChecksum().ToString().c_str());
+    return EXITCODE_OK;
+}
@@ -24,6 +24,7 @@
 #include "../park/ParkFile.h"
 #include "../platform/Crash.h"
 #include "../platform/Platform.h"
+#include "../profiling/StartupTrace.h"
 #include "../scripting/ScriptEngine.h"
 #include "CommandLine.hpp"
 
@@ -62,6 +63,7 @@ static u8string _userDataPath = {};
 static u8string _openrct2DataPath = {};
 static u8string _rct1DataPath = {};
 static u8string _rct2DataPath = {};
+static u8string _startupTracePath = {};
 static bool _silentBreakpad = false;
 
 // clang-format off
@@ -84,6 +86,7 @@ static constexpr CommandLineOptionDefinition StandardOptions[]
     { CMDLINE_TYPE_STRING,  &_openrct2DataPath, NAC, "openrct2-data-path", "path to the OpenRCT2 data directory (containing languages)" },
     { CMDLINE_TYPE_STRING,  &_rct1DataPath,     NAC, "rct1-data-path",     "path to the RollerCoaster Tycoon 1 data directory (containing data/csg1.dat)" },
     { CMDLINE_TYPE_STRING,  &_rct2DataPath,     NAC, "rct2-data-path",     "path to the RollerCoaster Tycoon 2 data directory (containing data/g1.dat)" },
+    { CMDLINE_TYPE_STRING,  &_startupTracePath, NAC, "startup-trace",      "write a trace of the startup stages to the given JSON file" },
 #ifdef USE_BREAKPAD
     { CMDLINE_TYPE_SWITCH,  &_silentBreakpad,  NAC, "silent-breakpad",   "make breakpad crash reporting silent"                       },
 #endif // USE_BREAKPAD
@@ -146,6 +149,9 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("sprite",          CommandLine::SpriteCommands           ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
     DefineSubCommand("parkinfo",        CommandLine::ParkInfoCommands         ),
+    DefineSubCommand("replay",          CommandLine::ReplayCommands           ),
+    DefineSubCommand("bench-paint",     CommandLine::BenchPaintCommands       ),
+    DefineSubCommand("bench-blit",      CommandLine::BenchBlitCommands        ),
     CommandTableEnd
 };
 
@@ -221,6 +227,11 @@ exitcode_t CommandLine::HandleCommandDefault()
         gCustomRCT2DataPath = Path::GetAbsolute(_rct2DataPath);
     }
 
+    if (!_startupTracePath.empty())
+    {
+        StartupTrace::SetOutputPath(Path::GetAbsolute(_startupTracePath));
+    }
+
     if (!_password.empty())
     {
         gCustomPassword = _password;
@@ -221,6 +221,11 @@ namespace OpenRCT2::Config
 #else
             model->MultiThreading = reader->GetBoolean("multithreading", true);
 #endif // _DEBUG
+            model->ObjectImageMemoryBudget = reader->GetInt32("object_image_memory_budget", 0);
+            model->WorkerThreads = reader->GetInt32("worker_threads", 0);
+            model->AdaptivePaintColumns = reader->GetBoolean("adaptive_paint_columns", true);
+            model->InteractionBuffer = reader->GetBoolean("interaction_buffer", true);
+            model->PaintTileCache = reader->GetBoolean("paint_tile_cache", true);
             model->TrapCursor = reader->GetBoolean("trap_cursor", false);
             model->AutoOpenShops = reader->GetBoolean("auto_open_shops", false);
             model->ScenarioSelectMode = reader->GetInt32("scenario_select_mode", SCENARIO_SELECT_MODE_ORIGIN);
@@ -235,6 +240,7 @@ namespace OpenRCT2::Config
             model->ZoomToCursor = reader->GetBoolean("zoom_to_cursor", true);
             model->RenderWeatherEffects = reader->GetBoolean("render_weather_effects", true);
             model->RenderWeatherGloom = reader->GetBoolean("render_weather_gloom", true);
+            model->LevelOfDetailCulling = reader->GetBoolean("level_of_detail_culling", true);
             model->ShowGuestPurchases = reader->GetBoolean("show_guest_purchases", false);
             model->ShowRealNamesOfGuests = reader->GetBoolean("show_real_names_of_guests", true);
             model->AllowEarlyCompletion = reader->GetBoolean("allow_early_completion", false);
@@ -307,6 +313,11 @@ namespace OpenRCT2::Config
         writer->WriteBoolean("infer_display_dpi", model->InferDisplayDPI);
         writer->WriteBoolean("show_fps", model->ShowFPS);
         writer->WriteBoolean("multithreading", model->MultiThreading);
+        writer->WriteInt32("object_image_memory_budget", model->ObjectImageMemoryBudget);
+        writer->WriteInt32("worker_threads", model->WorkerThreads);
+        writer->WriteBoolean("adaptive_paint_columns", model->AdaptivePaintColumns);
+        writer->WriteBoolean("interaction_buffer", model->InteractionBuffer);
+        writer->WriteBoolean("paint_tile_cache", model->PaintTileCache);
         writer->WriteBoolean("trap_cursor", model->TrapCursor);
         writer->WriteBoolean("auto_open_shops", model->AutoOpenShops);
         writer->WriteInt32("scenario_select_mode", model->ScenarioSelectMode);
@@ -321,6 +332,7 @@ namespace OpenRCT2::Config
         writer->WriteBoolean("zoom_to_cursor", model->ZoomToCursor);
         writer->WriteBoolean("render_weather_effects", model->RenderWeatherEffects);
         writer->WriteBoolean("render_weather_gloom", model->RenderWeatherGloom);
+        writer->WriteBoolean("level_of_detail_culling", model->LevelOfDetailCulling);
         writer->WriteBoolean("show_guest_purchases", model->ShowGuestPurchases);
         writer->WriteBoolean("show_real_names_of_guests", model->ShowRealNamesOfGuests);
         writer->WriteBoolean("allow_early_completion", model->AllowEarlyCompletion);
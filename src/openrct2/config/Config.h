@@ -42,6 +42,11 @@ namespace OpenRCT2::Config
         bool UseVSync;
         bool ShowFPS;
         std::atomic_uint8_t MultiThreading;
+        int32_t ObjectImageMemoryBudget;
+        int32_t WorkerThreads;
+        bool AdaptivePaintColumns;
+        bool InteractionBuffer;
+        bool PaintTileCache;
         bool MinimizeFullscreenFocusLoss;
         bool DisableScreensaver;
 
@@ -55,6 +60,7 @@ namespace OpenRCT2::Config
         bool UpperCaseBanners;
         bool RenderWeatherEffects;
         bool RenderWeatherGloom;
+        bool LevelOfDetailCulling;
         bool DisableLightningEffect;
         bool ShowGuestPurchases;
         bool TransparentScreenshot;
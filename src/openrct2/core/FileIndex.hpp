@@ -16,39 +16,36 @@
 #include "File.h"
 #include "FileScanner.h"
 #include "FileStream.h"
-#include "JobPool.h"
-#include "Numerics.hpp"
+#include "JobScheduler.h"
 #include "Path.hpp"
 
 #include <chrono>
 #include <list>
+#include <optional>
 #include <string>
-#include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
 {
-private:
-    struct DirectoryStats
+protected:
+    struct FileRecord
     {
-        uint32_t TotalFiles = 0;
-        uint64_t TotalFileSize = 0;
-        uint32_t FileDateModifiedChecksum = 0;
-        uint32_t PathChecksum = 0;
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
     };
 
-    struct ScanResult
+    /**
+     * A file recorded in the index along with the item that was created from it, if any.
+     */
+    struct IndexedFile
     {
-        DirectoryStats const Stats;
-        std::vector<std::string> const Files;
-
-        ScanResult(DirectoryStats stats, std::vector<std::string>&& files) noexcept
-            : Stats(stats)
-            , Files(std::move(files))
-        {
-        }
+        FileRecord File;
+        std::optional<TItem> Item;
     };
 
+private:
     struct FileIndexHeader
     {
         uint32_t HeaderSize = sizeof(FileIndexHeader);
@@ -56,12 +53,11 @@ private:
         uint8_t VersionA = 0;
         uint8_t VersionB = 0;
         uint16_t LanguageId = 0;
-        DirectoryStats Stats;
-        uint32_t NumItems = 0;
+        uint32_t NumFiles = 0;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -97,32 +93,21 @@ public:
     virtual ~FileIndex() = default;
 
     /**
-     * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * Queries the directories and loads the index. Items of files that are unchanged since the index
+     * was written are reused, only new or modified files are loaded again.
+     * @param reportProgress Update the progress window while files are loaded, must be false off the main and
+     *                       preloader threads.
      */
-    std::vector<TItem> LoadOrBuild(int32_t language) const
+    std::vector<TItem> LoadOrBuild(int32_t language, bool reportProgress = true) const
     {
-        std::vector<TItem> items;
-        auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
-        {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
-        }
-        else
-        {
-            // Index was not loaded
-            items = Build(language, scanResult);
-        }
-        return items;
+        auto files = Scan();
+        return Build(language, files, ReadIndexFile(language), reportProgress);
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
-        auto scanResult = Scan();
-        auto items = Build(language, scanResult);
-        return items;
+        auto files = Scan();
+        return Build(language, files, {});
     }
 
 protected:
@@ -136,11 +121,19 @@ protected:
      */
     virtual void Serialise(DataSerialiser& ds, const TItem& item) const = 0;
 
-private:
-    ScanResult Scan() const
+    const std::string& GetName() const
+    {
+        return _name;
+    }
+
+    const std::string& GetIndexPath() const
     {
-        DirectoryStats stats{};
-        std::vector<std::string> files;
+        return _indexPath;
+    }
+
+    std::vector<FileRecord> Scan() const
+    {
+        std::vector<FileRecord> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = OpenRCT2::Path::GetAbsolute(directory);
@@ -151,68 +144,123 @@ private:
             while (scanner->Next())
             {
                 const auto& fileInfo = scanner->GetFileInfo();
-                auto path = scanner->GetPath();
-
-                stats.TotalFiles++;
-                stats.TotalFileSize += fileInfo.Size;
-                stats.FileDateModifiedChecksum ^= static_cast<uint32_t>(fileInfo.LastModified >> 32)
-                    ^ static_cast<uint32_t>(fileInfo.LastModified & 0xFFFFFFFF);
-                stats.FileDateModifiedChecksum = OpenRCT2::Numerics::ror32(stats.FileDateModifiedChecksum, 5);
-                stats.PathChecksum += GetPathChecksum(path);
 
-                files.push_back(std::move(path));
+                FileRecord file;
+                file.Path = scanner->GetPath();
+                file.Size = fileInfo.Size;
+                file.LastModified = fileInfo.LastModified;
+                files.push_back(std::move(file));
             }
         }
-        return ScanResult(stats, std::move(files));
+        return files;
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    /**
+     * Pairs each of the given files with its item. Items of files that are unchanged since the previous index are
+     * reused, the others are created again.
+     * @return false if no file was added, changed or removed since the previous index.
+     */
+    bool CreateItems(
+        int32_t language, const std::vector<FileRecord>& files, std::unordered_map<std::string, IndexedFile>&& previousFiles,
+        std::vector<IndexedFile>& indexedFiles, bool reportProgress = true) const
     {
-        std::vector<TItem> allItems;
-        OpenRCT2::Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        indexedFiles.clear();
+        indexedFiles.resize(files.size());
+        std::vector<size_t> changedFiles;
+
+        // Reuse the items of all files that have not changed since the index was written
+        for (size_t i = 0; i < files.size(); i++)
+        {
+            const auto& file = files[i];
+            indexedFiles[i].File = file;
+
+            auto it = previousFiles.find(file.Path);
+            if (it != previousFiles.end() && it->second.File.Size == file.Size
+                && it->second.File.LastModified == file.LastModified)
+            {
+                indexedFiles[i].Item = std::move(it->second.Item);
+                previousFiles.erase(it);
+            }
+            else
+            {
+                changedFiles.push_back(i);
+            }
+        }
+
+        // Anything left over was removed from disk
+        const size_t removedCount = previousFiles.size();
+        if (changedFiles.empty() && removedCount == 0)
+        {
+            return false;
+        }
+
+        OpenRCT2::Console::WriteLine(
+            "Building %s (%zu of %zu items changed, %zu removed)", _name.c_str(), changedFiles.size(), files.size(),
+            removedCount);
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
+        const size_t totalCount = changedFiles.size();
         if (totalCount > 0)
         {
-            JobPool jobPool;
-            std::mutex mtx;
+            OpenRCT2::TaskGroup tasks;
             std::atomic<size_t> processed{ 0 };
 
-            for (size_t i = 0; i < totalCount; i++)
+            for (size_t index : changedFiles)
             {
-                jobPool.AddTask([&, index = i]() {
-                    const auto& filePath = scanResult.Files.at(index);
-
-                    if (auto item = Create(language, filePath); item.has_value())
-                    {
-                        std::lock_guard lock(mtx);
-                        allItems.push_back(std::move(item.value()));
-                    }
+                tasks.Run([&, index]() {
+                    auto& indexedFile = indexedFiles[index];
+                    indexedFile.Item = Create(language, indexedFile.File.Path);
 
                     processed++;
                 });
             }
 
-            jobPool.Join([&]() {
-                OpenRCT2::GetContext()->SetProgress(static_cast<uint32_t>(processed.load()), static_cast<uint32_t>(totalCount));
-            });
+            if (reportProgress)
+            {
+                tasks.Wait([&]() {
+                    OpenRCT2::GetContext()->SetProgress(
+                        static_cast<uint32_t>(processed.load()), static_cast<uint32_t>(totalCount));
+                });
+            }
+            else
+            {
+                tasks.Wait();
+            }
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
-
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
         OpenRCT2::Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
+        return true;
+    }
 
+private:
+    std::vector<TItem> Build(
+        int32_t language, const std::vector<FileRecord>& files,
+        std::unordered_map<std::string, IndexedFile>&& previousFiles, bool reportProgress = true) const
+    {
+        std::vector<IndexedFile> indexedFiles;
+        if (CreateItems(language, files, std::move(previousFiles), indexedFiles, reportProgress))
+        {
+            WriteIndexFile(language, indexedFiles);
+        }
+
+        std::vector<TItem> allItems;
+        allItems.reserve(indexedFiles.size());
+        for (auto& indexedFile : indexedFiles)
+        {
+            if (indexedFile.Item.has_value())
+            {
+                allItems.push_back(std::move(indexedFile.Item.value()));
+            }
+        }
         return allItems;
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    std::unordered_map<std::string, IndexedFile> ReadIndexFile(int32_t language) const
     {
-        bool loadedItems = false;
-        std::vector<TItem> items;
+        std::unordered_map<std::string, IndexedFile> indexedFiles;
         if (OpenRCT2::File::Exists(_indexPath))
         {
             try
@@ -220,24 +268,30 @@ private:
                 LOG_VERBOSE("FileIndex:Loading index: '%s'", _indexPath.c_str());
                 auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
 
-                // Read header, check if we need to re-scan
+                // Read header, check if the saved items can be used at all
                 auto header = fs.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
+                    indexedFiles.reserve(header.NumFiles);
                     DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
+                    for (uint32_t i = 0; i < header.NumFiles; i++)
                     {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
+                        IndexedFile indexedFile;
+                        uint8_t hasItem = 0;
+                        ds << indexedFile.File.Path;
+                        ds << indexedFile.File.Size;
+                        ds << indexedFile.File.LastModified;
+                        ds << hasItem;
+                        if (hasItem != 0)
+                        {
+                            TItem item;
+                            Serialise(ds, item);
+                            indexedFile.Item = std::move(item);
+                        }
+                        auto path = indexedFile.File.Path;
+                        indexedFiles.emplace(std::move(path), std::move(indexedFile));
                     }
-                    loadedItems = true;
                 }
                 else
                 {
@@ -248,12 +302,13 @@ private:
             {
                 OpenRCT2::Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 OpenRCT2::Console::Error::WriteLine("%s", e.what());
+                indexedFiles.clear();
             }
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        return indexedFiles;
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<TItem>& items) const
+    void WriteIndexFile(int32_t language, const std::vector<IndexedFile>& indexedFiles) const
     {
         try
         {
@@ -267,15 +322,22 @@ private:
             header.VersionA = FILE_INDEX_VERSION;
             header.VersionB = _version;
             header.LanguageId = language;
-            header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
+            header.NumFiles = static_cast<uint32_t>(indexedFiles.size());
             fs.WriteValue(header);
 
             DataSerialiser ds(true, fs);
-            // Write items
-            for (const auto& item : items)
+            // Write files and their items
+            for (const auto& indexedFile : indexedFiles)
             {
-                Serialise(ds, item);
+                uint8_t hasItem = indexedFile.Item.has_value() ? 1 : 0;
+                ds << indexedFile.File.Path;
+                ds << indexedFile.File.Size;
+                ds << indexedFile.File.LastModified;
+                ds << hasItem;
+                if (hasItem != 0)
+                {
+                    Serialise(ds, indexedFile.Item.value());
+                }
             }
         }
         catch (const std::exception& e)
@@ -284,19 +346,4 @@ private:
             OpenRCT2::Console::Error::WriteLine("%s", e.what());
         }
     }
-
-    static uint32_t GetPathChecksum(const std::string& path)
-    {
-        uint32_t hash = 0xD8430DED;
-        for (const utf8* ch = path.c_str(); *ch != '\0'; ch++)
-        {
-            hash += (*ch);
-            hash += (hash << 10);
-            hash ^= (hash >> 6);
-        }
-        hash += (hash << 3);
-        hash ^= (hash >> 11);
-        hash += (hash << 15);
-        return hash;
-    }
 };
@@ -0,0 +1,256 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "JobScheduler.h"
+
+#include <limits>
+
+namespace OpenRCT2
+{
+    static constexpr size_t kNotAWorker = std::numeric_limits<size_t>::max();
+
+    static thread_local size_t _workerIndex = kNotAWorker;
+
+    void Task::Run()
+    {
+        std::exception_ptr error;
+        try
+        {
+            _invoke(_storage);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        // Release the callable before completing, the group owner may tear down captured state once Wait returns.
+        _destroy(_storage);
+        _invoke = nullptr;
+        _move = nullptr;
+        _destroy = nullptr;
+
+        _group->OnTaskComplete(error);
+    }
+
+    JobScheduler::JobScheduler()
+    {
+        StartWorkers(0);
+    }
+
+    JobScheduler::~JobScheduler()
+    {
+        StopWorkers();
+    }
+
+    JobScheduler& JobScheduler::Get()
+    {
+        static JobScheduler scheduler;
+        return scheduler;
+    }
+
+    void JobScheduler::SetThreadCount(size_t count)
+    {
+        if (count == 0)
+        {
+            count = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+        if (count == _workers.size())
+            return;
+
+        StopWorkers();
+        StartWorkers(count);
+    }
+
+    void JobScheduler::Submit(Task&& task)
+    {
+        size_t index = _workerIndex;
+        if (index == kNotAWorker)
+        {
+            index = _nextWorker++ % _workers.size();
+        }
+
+        auto& worker = *_workers[index];
+        {
+            std::lock_guard<std::mutex> lock(worker.Mutex);
+            worker.Tasks.push_back(std::move(task));
+            _queuedCount++;
+        }
+        {
+            // Pairs with the predicate check in WorkerLoop so the wake up can not get lost.
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+        }
+        _sleepCond.notify_one();
+    }
+
+    bool JobScheduler::TryRunTask(const TaskGroup& group)
+    {
+        for (auto& worker : _workers)
+        {
+            std::optional<Task> task;
+            {
+                std::lock_guard<std::mutex> lock(worker->Mutex);
+                auto& tasks = worker->Tasks;
+                auto it = std::find_if(
+                    tasks.rbegin(), tasks.rend(), [&group](const Task& t) { return t.GetGroup() == &group; });
+                if (it == tasks.rend())
+                    continue;
+
+                task.emplace(std::move(*it));
+                tasks.erase(std::next(it).base());
+                _queuedCount--;
+            }
+            task->Run();
+            return true;
+        }
+        return false;
+    }
+
+    void JobScheduler::StartWorkers(size_t count)
+    {
+        if (count == 0)
+        {
+            count = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+
+        _shouldStop = false;
+        _workers.clear();
+        for (size_t i = 0; i < count; i++)
+        {
+            _workers.push_back(std::make_unique<Worker>());
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            _workers[i]->Thread = std::thread(&JobScheduler::WorkerLoop, this, i);
+        }
+    }
+
+    void JobScheduler::StopWorkers()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            _shouldStop = true;
+        }
+        _sleepCond.notify_all();
+
+        for (auto& worker : _workers)
+        {
+            if (worker->Thread.joinable())
+            {
+                worker->Thread.join();
+            }
+        }
+        _workers.clear();
+    }
+
+    void JobScheduler::WorkerLoop(size_t index)
+    {
+        _workerIndex = index;
+        while (true)
+        {
+            auto task = TryPop(index);
+            if (!task.has_value())
+            {
+                task = TrySteal(index);
+            }
+            if (task.has_value())
+            {
+                task->Run();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+            _sleepCond.wait(lock, [this] { return _shouldStop || _queuedCount > 0; });
+            if (_shouldStop)
+                break;
+        }
+        _workerIndex = kNotAWorker;
+    }
+
+    std::optional<Task> JobScheduler::TryPop(size_t index)
+    {
+        auto& worker = *_workers[index];
+        std::lock_guard<std::mutex> lock(worker.Mutex);
+        if (worker.Tasks.empty())
+            return std::nullopt;
+
+        std::optional<Task> task(std::move(worker.Tasks.back()));
+        worker.Tasks.pop_back();
+        _queuedCount--;
+        return task;
+    }
+
+    std::optional<Task> JobScheduler::TrySteal(size_t thiefIndex)
+    {
+        const auto count = _workers.size();
+        for (size_t i = 1; i < count; i++)
+        {
+            auto& victim = *_workers[(thiefIndex + i) % count];
+            std::lock_guard<std::mutex> lock(victim.Mutex);
+            if (victim.Tasks.empty())
+                continue;
+
+            std::optional<Task> task(std::move(victim.Tasks.front()));
+            victim.Tasks.pop_front();
+            _queuedCount--;
+            return task;
+        }
+        return std::nullopt;
+    }
+
+    TaskGroup::~TaskGroup()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cond.wait(lock, [this] { return _pending == 0; });
+    }
+
+    void TaskGroup::Wait(const std::function<void()>& reportFn)
+    {
+        auto& scheduler = JobScheduler::Get();
+        while (_pending > 0)
+        {
+            if (scheduler.TryRunTask(*this))
+            {
+                if (reportFn != nullptr)
+                    reportFn();
+                continue;
+            }
+
+            // Everything left is running on the workers, sleep until one of the tasks completes.
+            std::unique_lock<std::mutex> lock(_mutex);
+            const auto pending = _pending.load();
+            _cond.wait(lock, [this, pending] { return _pending == 0 || _pending != pending; });
+            lock.unlock();
+
+            if (reportFn != nullptr)
+                reportFn();
+        }
+
+        {
+            // Synchronise with the last OnTaskComplete before the group can be destroyed.
+            std::lock_guard<std::mutex> lock(_mutex);
+        }
+
+        if (_error != nullptr)
+        {
+            auto error = std::exchange(_error, nullptr);
+            std::rethrow_exception(error);
+        }
+    }
+
+    void TaskGroup::OnTaskComplete(std::exception_ptr error)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (error != nullptr && _error == nullptr)
+        {
+            _error = error;
+        }
+        _pending--;
+        _cond.notify_all();
+    }
+} // namespace OpenRCT2
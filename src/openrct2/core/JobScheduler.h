@@ -0,0 +1,246 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace OpenRCT2
+{
+    class TaskGroup;
+
+    /**
+     * A unit of work for the job scheduler. Callables that fit into the inline buffer are stored without
+     * a heap allocation, which covers lambdas capturing a handful of pointers or references.
+     */
+    class Task
+    {
+    private:
+        static constexpr size_t kInlineSize = 48;
+
+        using InvokeFn = void (*)(void*);
+        using MoveFn = void (*)(void*, void*);
+        using DestroyFn = void (*)(void*);
+
+        alignas(std::max_align_t) std::byte _storage[kInlineSize];
+        InvokeFn _invoke{};
+        MoveFn _move{};
+        DestroyFn _destroy{};
+        TaskGroup* _group{};
+
+    public:
+        template<typename TFn>
+        Task(TaskGroup* group, TFn&& fn)
+            : _group(group)
+        {
+            using TCallable = std::decay_t<TFn>;
+            if constexpr (sizeof(TCallable) <= kInlineSize && alignof(TCallable) <= alignof(std::max_align_t))
+            {
+                new (_storage) TCallable(std::forward<TFn>(fn));
+                _invoke = [](void* storage) { (*std::launder(reinterpret_cast<TCallable*>(storage)))(); };
+                _move = [](void* dst, void* src) {
+                    auto* srcCallable = std::launder(reinterpret_cast<TCallable*>(src));
+                    new (dst) TCallable(std::move(*srcCallable));
+                    srcCallable->~TCallable();
+                };
+                _destroy = [](void* storage) { std::launder(reinterpret_cast<TCallable*>(storage))->~TCallable(); };
+            }
+            else
+            {
+                new (_storage) TCallable*(new TCallable(std::forward<TFn>(fn)));
+                _invoke = [](void* storage) { (**reinterpret_cast<TCallable**>(storage))(); };
+                _move = [](void* dst, void* src) { new (dst) TCallable*(*reinterpret_cast<TCallable**>(src)); };
+                _destroy = [](void* storage) { delete *reinterpret_cast<TCallable**>(storage); };
+            }
+        }
+
+        Task(Task&& other) noexcept
+            : _invoke(other._invoke)
+            , _move(other._move)
+            , _destroy(other._destroy)
+            , _group(other._group)
+        {
+            if (_move != nullptr)
+            {
+                _move(_storage, other._storage);
+            }
+            other._invoke = nullptr;
+            other._move = nullptr;
+            other._destroy = nullptr;
+        }
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                this->~Task();
+                new (this) Task(std::move(other));
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task()
+        {
+            if (_destroy != nullptr)
+            {
+                _destroy(_storage);
+            }
+        }
+
+        TaskGroup* GetGroup() const
+        {
+            return _group;
+        }
+
+        void Run();
+    };
+
+    /**
+     * Process-wide pool of worker threads. Each worker owns a deque of tasks: it takes new work from the back
+     * of its own deque and steals from the front of the other workers' deques once it runs out.
+     */
+    class JobScheduler
+    {
+    private:
+        struct Worker
+        {
+            std::mutex Mutex;
+            std::deque<Task> Tasks;
+            std::thread Thread;
+        };
+
+        std::vector<std::unique_ptr<Worker>> _workers;
+        std::atomic<size_t> _nextWorker{ 0 };
+        std::atomic<size_t> _queuedCount{ 0 };
+        std::mutex _sleepMutex;
+        std::condition_variable _sleepCond;
+        bool _shouldStop{};
+
+        JobScheduler();
+
+    public:
+        ~JobScheduler();
+
+        static JobScheduler& Get();
+
+        size_t GetThreadCount() const
+        {
+            return _workers.size();
+        }
+
+        /**
+         * Restarts the workers with the given number of threads, 0 picks one per hardware thread.
+         * Must not be called while tasks are queued or running.
+         */
+        void SetThreadCount(size_t count);
+
+        void Submit(Task&& task);
+
+        /**
+         * Removes and runs one queued task of the given group, returns false if none is queued.
+         */
+        bool TryRunTask(const TaskGroup& group);
+
+    private:
+        void StartWorkers(size_t count);
+        void StopWorkers();
+        void WorkerLoop(size_t index);
+        std::optional<Task> TryPop(size_t index);
+        std::optional<Task> TrySteal(size_t thiefIndex);
+    };
+
+    /**
+     * A set of tasks that can be waited on. The waiting thread helps running the tasks of this group, so groups
+     * can be nested inside tasks and long running tasks of other groups can not stall the wait.
+     * The first exception thrown by a task is rethrown from Wait.
+     */
+    class TaskGroup
+    {
+    private:
+        std::atomic<size_t> _pending{ 0 };
+        std::mutex _mutex;
+        std::condition_variable _cond;
+        std::exception_ptr _error;
+
+        friend class Task;
+
+    public:
+        TaskGroup() = default;
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+        ~TaskGroup();
+
+        template<typename TFn> void Run(TFn&& fn)
+        {
+            _pending++;
+            JobScheduler::Get().Submit(Task(this, std::forward<TFn>(fn)));
+        }
+
+        /**
+         * Blocks until all tasks of the group are complete. The optional report function is called on the waiting
+         * thread after tasks complete, so progress can be reported from it.
+         */
+        void Wait(const std::function<void()>& reportFn = nullptr);
+
+        bool IsIdle() const
+        {
+            return _pending == 0;
+        }
+
+    private:
+        void OnTaskComplete(std::exception_ptr error);
+    };
+
+    /**
+     * Calls fn for every index in [begin, end) using the job scheduler, returns once all calls are complete.
+     */
+    template<typename TFn> void ParallelFor(size_t begin, size_t end, TFn&& fn, size_t grainSize = 0)
+    {
+        if (begin >= end)
+            return;
+
+        const size_t count = end - begin;
+        if (grainSize == 0)
+        {
+            // Split into a few chunks per thread so stealing can even out uneven work.
+            const size_t numChunks = std::max<size_t>(1, JobScheduler::Get().GetThreadCount() * 4);
+            grainSize = std::max<size_t>(1, (count + numChunks - 1) / numChunks);
+        }
+
+        TaskGroup group;
+        for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += grainSize)
+        {
+            const size_t chunkEnd = std::min(end, chunkBegin + grainSize);
+            group.Run([&fn, chunkBegin, chunkEnd]() {
+                for (size_t i = chunkBegin; i < chunkEnd; i++)
+                {
+                    fn(i);
+                }
+            });
+        }
+        group.Wait();
+    }
+} // namespace OpenRCT2
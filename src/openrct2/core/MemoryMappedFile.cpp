@@ -0,0 +1,116 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MemoryMappedFile.h"
+
+#include "IStream.hpp"
+
+#include <string>
+
+#ifdef _WIN32
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace OpenRCT2
+{
+#ifdef _WIN32
+    MemoryMappedFile::MemoryMappedFile(u8string_view path)
+    {
+        auto pathW = String::ToWideChar(path);
+        auto file = CreateFileW(
+            pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw IOException("Unable to open '" + std::string(path) + "'");
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            CloseHandle(file);
+            throw IOException("Unable to get size of '" + std::string(path) + "'");
+        }
+        _fileHandle = file;
+        _length = static_cast<size_t>(fileSize.QuadPart);
+        if (_length == 0)
+            return;
+
+        _mappingHandle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (_mappingHandle != nullptr)
+        {
+            _data = static_cast<const uint8_t*>(MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        }
+        if (_data == nullptr)
+        {
+            if (_mappingHandle != nullptr)
+                CloseHandle(_mappingHandle);
+            CloseHandle(file);
+            throw IOException("Unable to map '" + std::string(path) + "'");
+        }
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (_data != nullptr)
+            UnmapViewOfFile(_data);
+        if (_mappingHandle != nullptr)
+            CloseHandle(_mappingHandle);
+        if (_fileHandle != nullptr)
+            CloseHandle(_fileHandle);
+    }
+#else
+    MemoryMappedFile::MemoryMappedFile(u8string_view path)
+    {
+        std::string pathString(path);
+        int fd = open(pathString.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            throw IOException("Unable to open '" + pathString + "'");
+        }
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode))
+        {
+            close(fd);
+            throw IOException("Unable to open '" + pathString + "'");
+        }
+
+        _length = static_cast<size_t>(fileStat.st_size);
+        if (_length != 0)
+        {
+            void* data = mmap(nullptr, _length, PROT_READ, MAP_SHARED, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                close(fd);
+                throw IOException("Unable to map '" + pathString + "'");
+            }
+            _data = static_cast<const uint8_t*>(data);
+        }
+
+        // The mapping stays valid after the descriptor is closed.
+        close(fd);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (_data != nullptr)
+        {
+            munmap(const_cast<uint8_t*>(_data), _length);
+        }
+    }
+#endif
+} // namespace OpenRCT2
@@ -0,0 +1,49 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "String.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OpenRCT2
+{
+    /**
+     * A file mapped read-only into memory. Pages are only read from disk once they are accessed and are shared
+     * between all processes mapping the same file.
+     */
+    class MemoryMappedFile final
+    {
+    private:
+        const uint8_t* _data{};
+        size_t _length{};
+#ifdef _WIN32
+        void* _fileHandle{};
+        void* _mappingHandle{};
+#endif
+
+    public:
+        explicit MemoryMappedFile(u8string_view path);
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        ~MemoryMappedFile();
+
+        const uint8_t* GetData() const
+        {
+            return _data;
+        }
+
+        size_t GetLength() const
+        {
+            return _length;
+        }
+    };
+} // namespace OpenRCT2
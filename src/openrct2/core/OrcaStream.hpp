@@ -13,11 +13,14 @@
 #include "Crypt.h"
 #include "FileStream.h"
 #include "Identifier.hpp"
+#include "JobScheduler.h"
 #include "MemoryStream.h"
 
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <exception>
+#include <optional>
 #include <stack>
 #include <type_traits>
 #include <vector>
@@ -36,6 +39,11 @@ namespace OpenRCT2
         static constexpr uint32_t COMPRESSION_NONE = 0;
         static constexpr uint32_t COMPRESSION_GZIP = 1;
 
+        // The gzip stream is made of one deflate segment per chunk and is followed by a table that locates each
+        // segment, so chunks can be compressed and inflated separately. Builds that do not know this flag read the
+        // file as a single gzip stream.
+        static constexpr uint32_t FLAG_CHUNK_INDEX = 1 << 0;
+
     private:
 #pragma pack(push, 1)
         struct Header
@@ -48,7 +56,8 @@ namespace OpenRCT2
             uint32_t Compression{};
             uint64_t CompressedSize{};
             std::array<uint8_t, 8> FNV1a{};
-            uint8_t padding[20];
+            uint32_t Flags{};
+            uint8_t padding[16];
         };
         static_assert(sizeof(Header) == 64, "Header should be 64 bytes");
 
@@ -58,6 +67,12 @@ namespace OpenRCT2
             uint64_t Offset{};
             uint64_t Length{};
         };
+
+        struct ChunkIndexEntry
+        {
+            uint64_t CompressedOffset{};
+            uint64_t CompressedLength{};
+        };
 #pragma pack(pop)
 
         IStream* _stream;
@@ -67,8 +82,17 @@ namespace OpenRCT2
         MemoryStream _buffer;
         ChunkEntry _currentChunk;
 
+        // Compressed chunks that are only inflated once they are read
+        bool _deferred{};
+        uint64_t _compressedDataStart{};
+        std::vector<ChunkIndexEntry> _chunkIndex;
+
     public:
-        OrcaStream(IStream& stream, const Mode mode)
+        /**
+         * @param deferChunks Only inflate chunks when they are read, the stream must outlive the OrcaStream and
+         *                    support seeking. Has no effect on files without a chunk index.
+         */
+        OrcaStream(IStream& stream, const Mode mode, const bool deferChunks = false)
         {
             _stream = &stream;
             _mode = mode;
@@ -83,6 +107,17 @@ namespace OpenRCT2
                     _chunks.push_back(entry);
                 }
 
+                if (_header.Compression == COMPRESSION_GZIP && (_header.Flags & FLAG_CHUNK_INDEX))
+                {
+                    ReadChunkIndex();
+                    _deferred = true;
+                    if (!deferChunks)
+                    {
+                        DecompressAllChunks();
+                    }
+                    return;
+                }
+
                 // Read compressed data into buffer (read in blocks)
                 _buffer = MemoryStream{};
                 uint8_t temp[2048];
@@ -120,49 +155,54 @@ namespace OpenRCT2
 
         ~OrcaStream()
         {
-            if (_mode == Mode::WRITING)
+            if (_mode == Mode::WRITING && _stream != nullptr)
             {
-                const void* uncompressedData = _buffer.GetData();
-                const uint64_t uncompressedSize = _buffer.GetLength();
-
-                _header.NumChunks = static_cast<uint32_t>(_chunks.size());
-                _header.UncompressedSize = uncompressedSize;
-                _header.CompressedSize = uncompressedSize;
-                _header.FNV1a = Crypt::FNV1a(uncompressedData, uncompressedSize);
+                WriteImage(*_stream, _header, _chunks, _buffer);
+            }
+        }
 
-                // Compress data
-                std::optional<std::vector<uint8_t>> compressedBytes;
-                if (_header.Compression == COMPRESSION_GZIP)
-                {
-                    compressedBytes = Gzip(uncompressedData, uncompressedSize);
-                    if (compressedBytes)
-                    {
-                        _header.CompressedSize = compressedBytes->size();
-                    }
-                    else
-                    {
-                        // Compression failed
-                        _header.Compression = COMPRESSION_NONE;
-                    }
-                }
+        /**
+         * A fully serialised park that has not been compressed or written yet. It owns all of its data so
+         * it can be written from another thread.
+         */
+        class Image
+        {
+            friend class OrcaStream;
 
-                // Write header and chunk table
-                _stream->WriteValue(_header);
-                for (const auto& chunk : _chunks)
-                {
-                    _stream->WriteValue(chunk);
-                }
+            Header _header;
+            std::vector<ChunkEntry> _chunks;
+            MemoryStream _buffer;
 
-                // Write chunk data
-                if (compressedBytes)
-                {
-                    _stream->Write(compressedBytes->data(), compressedBytes->size());
-                }
-                else
-                {
-                    _stream->Write(uncompressedData, uncompressedSize);
-                }
+        public:
+            void Write(IStream& stream)
+            {
+                WriteImage(stream, _header, _chunks, _buffer);
             }
+        };
+
+        /**
+         * Creates a stream for writing that is not attached to any output, the result is retrieved using
+         * TakeImage.
+         */
+        OrcaStream()
+        {
+            _stream = nullptr;
+            _mode = Mode::WRITING;
+            _header = {};
+            _header.Compression = COMPRESSION_GZIP;
+        }
+
+        /**
+         * Moves the serialised chunks out of the stream. Nothing will be written when the stream is destroyed.
+         */
+        Image TakeImage()
+        {
+            Image image;
+            image._header = _header;
+            image._chunks = std::move(_chunks);
+            image._buffer = std::move(_buffer);
+            _stream = nullptr;
+            return image;
         }
 
         Mode GetMode() const
@@ -180,10 +220,54 @@ namespace OpenRCT2
             return _header;
         }
 
+        /**
+         * Inflates all deferred chunks at once, which is faster than inflating them one at a time as they are read.
+         */
+        void DecompressAllChunks()
+        {
+            if (!_deferred)
+                return;
+
+            std::vector<uint8_t> compressedStorage;
+            const auto* compressedData = GetCompressedData(0, _header.CompressedSize, compressedStorage);
+
+            std::vector<uint8_t> uncompressedData(static_cast<size_t>(_header.UncompressedSize));
+            // ParallelFor rethrows the first error once all chunks are done.
+            ParallelFor(
+                0, _chunks.size(),
+                [&](size_t i) {
+                    const auto& entry = _chunkIndex[i];
+                    if (entry.CompressedLength == 0)
+                        return;
+
+                    const auto& chunk = _chunks[i];
+                    auto data = InflateSegment(
+                        compressedData + entry.CompressedOffset, static_cast<size_t>(entry.CompressedLength),
+                        static_cast<size_t>(chunk.Length));
+                    CheckChunkLength(chunk, data.size());
+                    std::memcpy(uncompressedData.data() + chunk.Offset, data.data(), data.size());
+                },
+                1);
+
+            _buffer = MemoryStream(std::move(uncompressedData));
+            _deferred = false;
+        }
+
         template<typename TFunc> bool ReadWriteChunk(const uint32_t chunkId, TFunc f)
         {
             if (_mode == Mode::READING)
             {
+                if (_deferred)
+                {
+                    auto chunkBuffer = DecompressChunk(chunkId);
+                    if (!chunkBuffer.has_value())
+                        return false;
+
+                    ChunkStream stream(*chunkBuffer, _mode);
+                    f(stream);
+                    return true;
+                }
+
                 if (SeekChunk(chunkId))
                 {
                     ChunkStream stream(_buffer, _mode);
@@ -205,6 +289,187 @@ namespace OpenRCT2
         }
 
     private:
+        static void WriteImage(IStream& stream, Header header, const std::vector<ChunkEntry>& chunks, MemoryStream& buffer)
+        {
+            const void* uncompressedData = buffer.GetData();
+            const uint64_t uncompressedSize = buffer.GetLength();
+
+            header.NumChunks = static_cast<uint32_t>(chunks.size());
+            header.UncompressedSize = uncompressedSize;
+            header.CompressedSize = uncompressedSize;
+            header.FNV1a = Crypt::FNV1a(uncompressedData, uncompressedSize);
+
+            if (header.Compression == COMPRESSION_GZIP && AreChunksConsecutive(chunks, uncompressedSize))
+            {
+                WriteIndexedChunks(stream, header, chunks, buffer);
+                return;
+            }
+
+            // Compress data
+            std::optional<std::vector<uint8_t>> compressedBytes;
+            if (header.Compression == COMPRESSION_GZIP)
+            {
+                compressedBytes = Gzip(uncompressedData, uncompressedSize);
+                if (compressedBytes)
+                {
+                    header.CompressedSize = compressedBytes->size();
+                }
+                else
+                {
+                    // Compression failed
+                    header.Compression = COMPRESSION_NONE;
+                }
+            }
+
+            // Write header and chunk table
+            stream.WriteValue(header);
+            for (const auto& chunk : chunks)
+            {
+                stream.WriteValue(chunk);
+            }
+
+            // Write chunk data
+            if (compressedBytes)
+            {
+                stream.Write(compressedBytes->data(), compressedBytes->size());
+            }
+            else
+            {
+                stream.Write(uncompressedData, uncompressedSize);
+            }
+        }
+
+        /**
+         * Chunks are written one after the other, so together they cover the whole buffer.
+         */
+        static bool AreChunksConsecutive(const std::vector<ChunkEntry>& chunks, uint64_t uncompressedSize)
+        {
+            uint64_t offset = 0;
+            for (const auto& chunk : chunks)
+            {
+                if (chunk.Offset != offset)
+                    return false;
+                offset += chunk.Length;
+            }
+            return offset == uncompressedSize;
+        }
+
+        static void WriteIndexedChunks(
+            IStream& stream, Header& header, const std::vector<ChunkEntry>& chunks, MemoryStream& buffer)
+        {
+            const auto* uncompressedData = static_cast<const uint8_t*>(buffer.GetData());
+
+            // Chunks are deflated independently, so they can all be compressed at the same time.
+            std::vector<DeflatedSegment> segments(chunks.size());
+            ParallelFor(
+                0, chunks.size(),
+                [&](size_t i) {
+                    const auto& chunk = chunks[i];
+                    if (chunk.Length == 0)
+                        return;
+
+                    segments[i] = DeflateSegment(uncompressedData + chunk.Offset, static_cast<size_t>(chunk.Length));
+                },
+                1);
+
+            std::vector<uint64_t> segmentOffsets;
+            const auto compressedBytes = GzipJoinSegments(segments, segmentOffsets);
+            header.Flags |= FLAG_CHUNK_INDEX;
+            header.CompressedSize = compressedBytes.size();
+
+            // Write header and chunk table
+            stream.WriteValue(header);
+            for (const auto& chunk : chunks)
+            {
+                stream.WriteValue(chunk);
+            }
+
+            // Write chunk data, followed by the chunk index which older builds do not read
+            stream.Write(compressedBytes.data(), compressedBytes.size());
+            for (size_t i = 0; i < chunks.size(); i++)
+            {
+                stream.WriteValue(ChunkIndexEntry{ segmentOffsets[i], segments[i].Data.size() });
+            }
+        }
+
+        void ReadChunkIndex()
+        {
+            _compressedDataStart = _stream->GetPosition();
+            if (_header.CompressedSize > _stream->GetLength() - _compressedDataStart)
+            {
+                throw IOException("Compressed data exceeds the file.");
+            }
+            _stream->SetPosition(_compressedDataStart + _header.CompressedSize);
+
+            const auto compressedSize = _header.CompressedSize;
+            const auto uncompressedSize = _header.UncompressedSize;
+            for (const auto& chunk : _chunks)
+            {
+                const auto entry = _stream->ReadValue<ChunkIndexEntry>();
+                if ((entry.CompressedLength == 0) != (chunk.Length == 0))
+                {
+                    throw IOException("Chunk is missing its compressed data.");
+                }
+                if (entry.CompressedLength > compressedSize || entry.CompressedOffset > compressedSize - entry.CompressedLength)
+                {
+                    throw IOException("Chunk exceeds the compressed size.");
+                }
+                if (chunk.Length > uncompressedSize || chunk.Offset > uncompressedSize - chunk.Length)
+                {
+                    throw IOException("Chunk exceeds the uncompressed size.");
+                }
+                _chunkIndex.push_back(entry);
+            }
+        }
+
+        /**
+         * Streams backed by memory, such as a mapped file, are inflated in place. Other streams are read into storage.
+         * The range has been checked against the stream length by ReadChunkIndex.
+         */
+        const uint8_t* GetCompressedData(uint64_t offset, uint64_t length, std::vector<uint8_t>& storage)
+        {
+            const auto* data = static_cast<const uint8_t*>(_stream->GetData());
+            if (data != nullptr)
+            {
+                return data + _compressedDataStart + offset;
+            }
+
+            storage.resize(static_cast<size_t>(length));
+            _stream->SetPosition(_compressedDataStart + offset);
+            _stream->Read(storage.data(), storage.size());
+            return storage.data();
+        }
+
+        std::optional<MemoryStream> DecompressChunk(const uint32_t id)
+        {
+            const auto result = std::find_if(_chunks.begin(), _chunks.end(), [id](const ChunkEntry& e) { return e.Id == id; });
+            if (result == _chunks.end())
+                return std::nullopt;
+
+            const auto& entry = _chunkIndex[std::distance(_chunks.begin(), result)];
+            if (entry.CompressedLength == 0)
+                return MemoryStream{};
+
+            std::vector<uint8_t> compressedStorage;
+            const auto* compressedData = GetCompressedData(entry.CompressedOffset, entry.CompressedLength, compressedStorage);
+
+            auto data = InflateSegment(
+                compressedData, static_cast<size_t>(entry.CompressedLength), static_cast<size_t>(result->Length));
+            CheckChunkLength(*result, data.size());
+            return MemoryStream(std::move(data));
+        }
+
+        /**
+         * A chunk that inflates to a different size than its table entry says is corrupt or truncated.
+         */
+        static void CheckChunkLength(const ChunkEntry& chunk, size_t inflatedLength)
+        {
+            if (inflatedLength != chunk.Length)
+            {
+                throw IOException("Chunk does not inflate to its uncompressed size.");
+            }
+        }
+
         bool SeekChunk(const uint32_t id)
         {
             const auto result = std::find_if(_chunks.begin(), _chunks.end(), [id](const ChunkEntry& e) { return e.Id == id; });
@@ -41,6 +41,60 @@ void MaskAvx2(
     }
 }
 
+/**
+ * Looks up 32 indices in a 256 entry table. The gathers read the aligned 4 bytes that hold each entry, so they never
+ * read past the end of the table, and shift the entry down.
+ */
+static __m256i LookupAvx2(const uint8_t* RESTRICT table, const uint8_t* RESTRICT indices)
+{
+    const __m256i alignMask = _mm256_set1_epi32(~3);
+    const __m256i byteMask = _mm256_set1_epi32(0xFF);
+    __m256i entries[4];
+    for (int32_t i = 0; i < 4; i++)
+    {
+        const __m256i index = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(indices + i * 8)));
+        const __m256i words = _mm256_i32gather_epi32(
+            reinterpret_cast<const int*>(table), _mm256_and_si256(index, alignMask), 1);
+        const __m256i shift = _mm256_slli_epi32(_mm256_andnot_si256(alignMask, index), 3);
+        entries[i] = _mm256_and_si256(_mm256_srlv_epi32(words, shift), byteMask);
+    }
+
+    // Packing works within 128 bit lanes, which leaves the 4 byte groups out of order
+    const __m256i packed = _mm256_packus_epi16(
+        _mm256_packus_epi32(entries[0], entries[1]), _mm256_packus_epi32(entries[2], entries[3]));
+    return _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+void RemapRunAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT table)
+{
+    const __m256i zero = {};
+    int32_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i colour = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        const __m256i remapped = LookupAvx2(table, src + i);
+        const __m256i keep = _mm256_or_si256(_mm256_cmpeq_epi8(colour, zero), _mm256_cmpeq_epi8(remapped, zero));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_blendv_epi8(remapped, dest, keep));
+    }
+    RemapRunScalar(src + i, dst + i, count - i, table);
+}
+
+void FilterRunAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT table)
+{
+    const __m256i zero = {};
+    int32_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i colour = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        const __m256i filtered = LookupAvx2(table, dst + i);
+        const __m256i keep = _mm256_or_si256(_mm256_cmpeq_epi8(colour, zero), _mm256_cmpeq_epi8(filtered, zero));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_blendv_epi8(filtered, dest, keep));
+    }
+    FilterRunScalar(src + i, dst + i, count - i, table);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -54,4 +108,14 @@ void MaskAvx2(
     OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void RemapRunAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT table)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void FilterRunAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT table)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
@@ -0,0 +1,95 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "DirtyRects.h"
+
+#include <algorithm>
+
+using namespace OpenRCT2::Drawing;
+
+static int64_t GetArea(const ScreenRect& rect)
+{
+    return static_cast<int64_t>(rect.GetWidth()) * rect.GetHeight();
+}
+
+static ScreenRect GetUnion(const ScreenRect& a, const ScreenRect& b)
+{
+    return { std::min(a.GetLeft(), b.GetLeft()), std::min(a.GetTop(), b.GetTop()), std::max(a.GetRight(), b.GetRight()),
+             std::max(a.GetBottom(), b.GetBottom()) };
+}
+
+static bool IsInside(const ScreenRect& inner, const ScreenRect& outer)
+{
+    return inner.GetLeft() >= outer.GetLeft() && inner.GetTop() >= outer.GetTop() && inner.GetRight() <= outer.GetRight()
+        && inner.GetBottom() <= outer.GetBottom();
+}
+
+void DirtyRects::Resize(int32_t width, int32_t height)
+{
+    _width = std::max(0, width);
+    _height = std::max(0, height);
+    SetFull();
+}
+
+void DirtyRects::Add(const ScreenRect& rect)
+{
+    auto clipped = ScreenRect(
+        std::max(rect.GetLeft(), 0), std::max(rect.GetTop(), 0), std::min(rect.GetRight(), _width),
+        std::min(rect.GetBottom(), _height));
+    if (clipped.GetWidth() <= 0 || clipped.GetHeight() <= 0 || Contains(clipped))
+        return;
+
+    // Keep merging with the cheapest rect, the merged rect may make further merges worthwhile
+    while (true)
+    {
+        auto best = _rects.end();
+        auto bestCost = kMergeCost;
+        for (auto it = _rects.begin(); it != _rects.end(); it++)
+        {
+            const auto cost = GetArea(GetUnion(clipped, *it)) - GetArea(clipped) - GetArea(*it);
+            if (cost <= bestCost)
+            {
+                best = it;
+                bestCost = cost;
+            }
+        }
+        if (best == _rects.end())
+            break;
+
+        clipped = GetUnion(clipped, *best);
+        *best = _rects.back();
+        _rects.pop_back();
+    }
+
+    _rects.push_back(clipped);
+    if (_rects.size() > kMaxRects)
+    {
+        SetFull();
+    }
+}
+
+void DirtyRects::Clear()
+{
+    _rects.clear();
+    _full = false;
+}
+
+bool DirtyRects::Contains(const ScreenRect& rect) const
+{
+    if (rect.GetWidth() <= 0 || rect.GetHeight() <= 0)
+        return true;
+
+    return std::any_of(_rects.begin(), _rects.end(), [&rect](const ScreenRect& dirty) { return IsInside(rect, dirty); });
+}
+
+void DirtyRects::SetFull()
+{
+    _rects.assign(1, ScreenRect(0, 0, _width, _height));
+    _full = true;
+}
@@ -0,0 +1,58 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../world/Location.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace OpenRCT2::Drawing
+{
+    /**
+     * The regions of the screen that need to be painted again. Rects are exclusive of their right and bottom edge.
+     * Two rects are merged when painting their bounding box costs less than painting both, so a moving peep dirties
+     * little more than itself. Once there are too many rects the whole screen is painted instead.
+     */
+    class DirtyRects
+    {
+    public:
+        // Painting a rect has a fixed overhead, walking windows and setting up paint sessions, counted in pixels
+        static constexpr int64_t kMergeCost = 4096;
+        static constexpr size_t kMaxRects = 64;
+
+        void Resize(int32_t width, int32_t height);
+        void Add(const ScreenRect& rect);
+        void Clear();
+
+        /**
+         * Returns whether the rect will be painted, an empty rect is always painted.
+         */
+        bool Contains(const ScreenRect& rect) const;
+
+        bool IsFull() const
+        {
+            return _full;
+        }
+
+        const std::vector<ScreenRect>& GetRects() const
+        {
+            return _rects;
+        }
+
+    private:
+        int32_t _width{};
+        int32_t _height{};
+        bool _full{};
+        std::vector<ScreenRect> _rects;
+
+        void SetFull();
+    };
+} // namespace OpenRCT2::Drawing
@@ -8,10 +8,43 @@
  *****************************************************************************/
 
 #include "Drawing.h"
+#include "ZoomedSpriteCache.h"
 
 #include <cassert>
 #include <cstring>
 
+using namespace OpenRCT2::Drawing;
+
+void RemapRunScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT table)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (src[i] == 0)
+            continue;
+
+        auto pixel = table[src[i]];
+        if (pixel != 0)
+        {
+            dst[i] = pixel;
+        }
+    }
+}
+
+void FilterRunScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT table)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (src[i] == 0)
+            continue;
+
+        auto pixel = table[dst[i]];
+        if (pixel != 0)
+        {
+            dst[i] = pixel;
+        }
+    }
+}
+
 template<DrawBlendOp TBlendOp, size_t TZoom>
 static void FASTCALL DrawRLESpriteMagnify(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
 {
@@ -83,7 +116,7 @@ static void FASTCALL DrawRLESpriteMagnify(DrawPixelInfo& dpi, const DrawSpriteAr
     }
 }
 
-template<DrawBlendOp TBlendOp, size_t TZoom>
+template<DrawBlendOp TBlendOp, size_t TZoom, bool TUseRunFunctions = true>
 static void FASTCALL DrawRLESpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
 {
     auto src0 = args.SourceImage.offset;
@@ -94,6 +127,7 @@ static void FASTCALL DrawRLESpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
     auto height = args.Height;
     auto zoom = 1 << TZoom;
     auto dstLineWidth = (static_cast<size_t>(dpi.width) >> TZoom) + dpi.pitch;
+    auto table = args.PalMap.GetTable();
 
     // Move up to the first line of the image if source_y_start is negative. Why does this even occur?
     if (srcY < 0)
@@ -155,7 +189,7 @@ static void FASTCALL DrawRLESpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
             numPixels = std::min(numPixels, width - x);
 
             auto dst = dstLineStart + (x >> TZoom);
-            if constexpr ((TBlendOp & BLEND_SRC) == 0 && (TBlendOp & BLEND_DST) == 0 && TZoom == 0)
+            if constexpr ((TBlendOp & BLEND_SRC) == 0 && (TBlendOp & BLEND_DST) == 0 && TZoom == 0 && TUseRunFunctions)
             {
                 // Since we're sampling each pixel at this zoom level, just do a straight std::memcpy
                 if (numPixels > 0)
@@ -165,6 +199,24 @@ static void FASTCALL DrawRLESpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
             }
             else
             {
+                // Remapped and translucent runs at full size are drawn by the vectorised run functions
+                if constexpr (TBlendOp == (BLEND_TRANSPARENT | BLEND_SRC) && TZoom == 0 && TUseRunFunctions)
+                {
+                    if (table != nullptr)
+                    {
+                        RemapRunFn(src, dst, numPixels, table);
+                        continue;
+                    }
+                }
+                else if constexpr (TBlendOp == (BLEND_TRANSPARENT | BLEND_DST) && TZoom == 0 && TUseRunFunctions)
+                {
+                    if (table != nullptr)
+                    {
+                        FilterRunFn(src, dst, numPixels, table);
+                        continue;
+                    }
+                }
+
                 auto& paletteMap = args.PalMap;
                 while (numPixels > 0)
                 {
@@ -178,6 +230,33 @@ static void FASTCALL DrawRLESpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
     }
 }
 
+/**
+ * Draws a zoomed out sprite from the zoomed sprite cache at full size, so only the pixels that are drawn get walked.
+ */
+template<DrawBlendOp TBlendOp, size_t TZoom>
+static void FASTCALL DrawRLESpriteZoomed(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
+{
+    constexpr int32_t kZoom = 1 << TZoom;
+    const auto phaseX = args.SrcX & (kZoom - 1);
+    const auto phaseY = args.SrcY & (kZoom - 1);
+    const auto sprite = GetZoomedSpriteCache().Get(args.Image.GetIndex(), args.SourceImage, dpi.zoom_level, phaseX, phaseY);
+    if (sprite == nullptr)
+    {
+        DrawRLESpriteMinify<TBlendOp, TZoom>(dpi, args);
+        return;
+    }
+
+    // The clipped origin is a whole number of zoomed pixels away from the phase. The runs of a zoomed sprite are short,
+    // so the per pixel loop beats calling memcpy or the run functions for each of them.
+    DrawPixelInfo zoomedDpi = dpi;
+    zoomedDpi.width = dpi.width >> TZoom;
+    zoomedDpi.zoom_level = ZoomLevel{ 0 };
+    const DrawSpriteArgs zoomedArgs(
+        args.Image, args.PalMap, sprite->Element, (args.SrcX - phaseX) >> TZoom, (args.SrcY - phaseY) >> TZoom,
+        (args.Width + kZoom - 1) >> TZoom, (args.Height + kZoom - 1) >> TZoom, args.DestinationBits);
+    DrawRLESpriteMinify<TBlendOp, 0, false>(zoomedDpi, zoomedArgs);
+}
+
 template<DrawBlendOp TBlendOp> static void FASTCALL DrawRLESprite(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
 {
     auto zoom_level = static_cast<int8_t>(dpi.zoom_level);
@@ -193,13 +272,13 @@ template<DrawBlendOp TBlendOp> static void FASTCALL DrawRLESprite(DrawPixelInfo&
             DrawRLESpriteMinify<TBlendOp, 0>(dpi, args);
             break;
         case 1:
-            DrawRLESpriteMinify<TBlendOp, 1>(dpi, args);
+            DrawRLESpriteZoomed<TBlendOp, 1>(dpi, args);
             break;
         case 2:
-            DrawRLESpriteMinify<TBlendOp, 2>(dpi, args);
+            DrawRLESpriteZoomed<TBlendOp, 2>(dpi, args);
             break;
         case 3:
-            DrawRLESpriteMinify<TBlendOp, 3>(dpi, args);
+            DrawRLESpriteZoomed<TBlendOp, 3>(dpi, args);
             break;
         default:
             assert(false);
@@ -14,16 +14,19 @@
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
 #include "../config/Config.h"
-#include "../core/FileStream.h"
+#include "../core/MemoryMappedFile.h"
 #include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../platform/Platform.h"
 #include "../rct1/Csg.h"
 #include "../sprites.h"
 #include "../ui/UiContext.h"
+#include "Image.h"
 #include "ScrollingText.h"
+#include "ZoomedSpriteCache.h"
 
 #include <cassert>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -115,10 +118,16 @@ static inline uint32_t rctc_to_rct2_index(uint32_t image)
 }
 // clang-format on
 
-static void ReadAndConvertGxDat(IStream* stream, size_t count, bool is_rctc, G1Element* elements)
+static RCTG1Element ReadGxElement(const uint8_t* elementData, size_t index)
+{
+    // The element table is not necessarily aligned within the file mapping.
+    RCTG1Element element;
+    std::memcpy(&element, elementData + index * sizeof(RCTG1Element), sizeof(RCTG1Element));
+    return element;
+}
+
+static void ConvertGxDat(const uint8_t* elementData, size_t count, bool is_rctc, G1Element* elements)
 {
-    auto g1Elements32 = std::make_unique<RCTG1Element[]>(count);
-    stream->Read(g1Elements32.get(), count * sizeof(RCTG1Element));
     if (is_rctc)
     {
         // Process RCTC's g1.dat file
@@ -147,7 +156,7 @@ static void ReadAndConvertGxDat(IStream* stream, size_t count, bool is_rctc, G1E
                     break;
             }
 
-            const RCTG1Element& src = g1Elements32[rctc];
+            const RCTG1Element src = ReadGxElement(elementData, rctc);
 
             // Double cast to silence compiler warning about casting to
             // pointer from integer of mismatched length.
@@ -186,7 +195,7 @@ static void ReadAndConvertGxDat(IStream* stream, size_t count, bool is_rctc, G1E
     {
         for (size_t i = 0; i < count; i++)
         {
-            const RCTG1Element& src = g1Elements32[i];
+            const RCTG1Element src = ReadGxElement(elementData, i);
 
             // Double cast to silence compiler warning about casting to
             // pointer from integer of mismatched length.
@@ -228,6 +237,9 @@ void MaskScalar(
 static Gx _g1 = {};
 static Gx _g2 = {};
 static Gx _csg = {};
+static std::unique_ptr<MemoryMappedFile> _g1File;
+static std::unique_ptr<MemoryMappedFile> _g2File;
+static std::unique_ptr<MemoryMappedFile> _csgFile;
 static G1Element _scrollingText[MaxScrollingTextEntries]{};
 static bool _csgLoaded = false;
 
@@ -235,6 +247,38 @@ static G1Element _g1Temp = {};
 static std::vector<G1Element> _imageListElements;
 bool gTinyFontAntiAliased = false;
 
+/**
+ * Maps a file laid out like g1.dat and reads its header. The sprite data is used straight from the mapping, so
+ * only the pages that are drawn get read from disk.
+ */
+static std::unique_ptr<MemoryMappedFile> OpenGxFile(u8string_view path, Gx& gx)
+{
+    auto file = std::make_unique<MemoryMappedFile>(path);
+    if (file->GetLength() < sizeof(RCTG1Header))
+    {
+        throw std::runtime_error("Graphics file is too small");
+    }
+    std::memcpy(&gx.header, file->GetData(), sizeof(RCTG1Header));
+
+    const auto requiredLength = sizeof(RCTG1Header) + static_cast<size_t>(gx.header.num_entries) * sizeof(RCTG1Element)
+        + gx.header.total_size;
+    if (file->GetLength() < requiredLength)
+    {
+        throw std::runtime_error("Graphics file is truncated");
+    }
+    return file;
+}
+
+static const uint8_t* GetGxElementData(const MemoryMappedFile& file)
+{
+    return file.GetData() + sizeof(RCTG1Header);
+}
+
+static const uint8_t* GetGxSpriteData(const MemoryMappedFile& file, const Gx& gx)
+{
+    return GetGxElementData(file) + static_cast<size_t>(gx.header.num_entries) * sizeof(RCTG1Element);
+}
+
 /**
  *
  *  rct2: 0x00678998
@@ -245,8 +289,7 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
     try
     {
         auto path = env.FindFile(DIRBASE::RCT2, DIRID::DATA, u8"g1.dat");
-        auto fs = FileStream(path, FILE_MODE_OPEN);
-        _g1.header = fs.ReadValue<RCTG1Header>();
+        auto file = OpenGxFile(path, _g1);
 
         LOG_VERBOSE("g1.dat, number of entries: %u", _g1.header.num_entries);
 
@@ -258,17 +301,16 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
         // Read element headers
         bool is_rctc = _g1.header.num_entries == SPR_RCTC_G1_END;
         _g1.elements.resize(_g1.header.num_entries);
-        ReadAndConvertGxDat(&fs, _g1.header.num_entries, is_rctc, _g1.elements.data());
+        ConvertGxDat(GetGxElementData(*file), _g1.header.num_entries, is_rctc, _g1.elements.data());
         gTinyFontAntiAliased = is_rctc;
 
-        // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
-
         // Fix entry data offsets
+        const auto* spriteData = GetGxSpriteData(*file, _g1);
         for (uint32_t i = 0; i < _g1.header.num_entries; i++)
         {
-            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(_g1.data.get());
+            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(spriteData);
         }
+        _g1File = std::move(file);
         return true;
     }
     catch (const std::exception&)
@@ -288,6 +330,8 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
 
 void GfxUnloadG1()
 {
+    Drawing::GetZoomedSpriteCache().Clear();
+    _g1File.reset();
     _g1.data.reset();
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
@@ -295,6 +339,8 @@ void GfxUnloadG1()
 
 void GfxUnloadG2()
 {
+    Drawing::GetZoomedSpriteCache().Clear();
+    _g2File.reset();
     _g2.data.reset();
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
@@ -302,6 +348,8 @@ void GfxUnloadG2()
 
 void GfxUnloadCsg()
 {
+    Drawing::GetZoomedSpriteCache().Clear();
+    _csgFile.reset();
     _csg.data.reset();
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
@@ -317,15 +365,11 @@ bool GfxLoadG2()
 
     try
     {
-        auto fs = FileStream(path, FILE_MODE_OPEN);
-        _g2.header = fs.ReadValue<RCTG1Header>();
+        auto file = OpenGxFile(path, _g2);
 
         // Read element headers
         _g2.elements.resize(_g2.header.num_entries);
-        ReadAndConvertGxDat(&fs, _g2.header.num_entries, false, _g2.elements.data());
-
-        // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
+        ConvertGxDat(GetGxElementData(*file), _g2.header.num_entries, false, _g2.elements.data());
 
         if (_g2.header.num_entries != G2_SPRITE_COUNT)
         {
@@ -344,10 +388,12 @@ bool GfxLoadG2()
         }
 
         // Fix entry data offsets
+        const auto* spriteData = GetGxSpriteData(*file, _g2);
         for (uint32_t i = 0; i < _g2.header.num_entries; i++)
         {
-            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(_g2.data.get());
+            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(spriteData);
         }
+        _g2File = std::move(file);
         return true;
     }
     catch (const std::exception&)
@@ -379,10 +425,10 @@ bool GfxLoadCsg()
     auto pathDataPath = FindCsg1datAtLocation(Config::Get().general.RCT1Path);
     try
     {
-        auto fileHeader = FileStream(pathHeaderPath, FILE_MODE_OPEN);
-        auto fileData = FileStream(pathDataPath, FILE_MODE_OPEN);
+        auto fileHeader = MemoryMappedFile(pathHeaderPath);
+        auto fileData = std::make_unique<MemoryMappedFile>(pathDataPath);
         size_t fileHeaderSize = fileHeader.GetLength();
-        size_t fileDataSize = fileData.GetLength();
+        size_t fileDataSize = fileData->GetLength();
 
         _csg.header.num_entries = static_cast<uint32_t>(fileHeaderSize / sizeof(RCTG1Element));
         _csg.header.total_size = static_cast<uint32_t>(fileDataSize);
@@ -395,21 +441,19 @@ bool GfxLoadCsg()
 
         // Read element headers
         _csg.elements.resize(_csg.header.num_entries);
-        ReadAndConvertGxDat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
-
-        // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        ConvertGxDat(fileHeader.GetData(), _csg.header.num_entries, false, _csg.elements.data());
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
         {
-            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(_csg.data.get());
+            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(fileData->GetData());
             // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
             if (_csg.elements[i].flags & G1_FLAG_HAS_ZOOM_SPRITE)
             {
                 _csg.elements[i].zoomed_offset = i - _csg.elements[i].zoomed_offset;
             }
         }
+        _csgFile = std::move(fileData);
         _csgLoaded = true;
         return true;
     }
@@ -433,8 +477,10 @@ std::optional<Gx> GfxLoadGx(const std::vector<uint8_t>& buffer)
         gx.header = istream.ReadValue<RCTG1Header>();
 
         // Read element headers
+        const auto elementsLength = static_cast<size_t>(gx.header.num_entries) * sizeof(RCTG1Element);
+        auto elementData = istream.ReadArray<uint8_t>(elementsLength);
         gx.elements.resize(gx.header.num_entries);
-        ReadAndConvertGxDat(&istream, gx.header.num_entries, false, gx.elements.data());
+        ConvertGxDat(elementData.get(), gx.header.num_entries, false, gx.elements.data());
 
         // Read element data
         gx.data = istream.ReadArray<uint8_t>(gx.header.total_size);
@@ -800,6 +846,11 @@ const G1Element* GfxGetG1Element(ImageIndex image_id)
         size_t idx = offset - SPR_IMAGE_LIST_BEGIN;
         if (idx < _imageListElements.size())
         {
+            // Released pixel data reads as missing until it is loaded again before the next frame
+            if (!GfxObjectUseImage(image_id))
+            {
+                return nullptr;
+            }
             return &_imageListElements[idx];
         }
     }
@@ -820,6 +871,7 @@ void GfxSetG1Element(ImageIndex imageId, const G1Element* g1)
 
     if (g1 != nullptr)
     {
+        Drawing::GetZoomedSpriteCache().Invalidate(imageId);
         if (isTemp)
         {
             _g1Temp = *g1;
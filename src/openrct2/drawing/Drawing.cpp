@@ -27,6 +27,7 @@
 
 #include <cassert>
 #include <cstring>
+#include <utility>
 
 using namespace OpenRCT2;
 
@@ -694,6 +695,32 @@ void MaskFn(
     MaskFunc(width, height, maskSrc, colourSrc, dst, maskWrap, colourWrap, dstWrap);
 }
 
+static auto GetSpriteRunFunctions()
+{
+    if (Platform::AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 sprite run functions");
+        return std::make_pair(RemapRunAvx2, FilterRunAvx2);
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar sprite run functions");
+        return std::make_pair(RemapRunScalar, FilterRunScalar);
+    }
+}
+
+static const auto SpriteRunFuncs = GetSpriteRunFunctions();
+
+void RemapRunFn(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT table)
+{
+    SpriteRunFuncs.first(src, dst, count, table);
+}
+
+void FilterRunFn(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT table)
+{
+    SpriteRunFuncs.second(src, dst, count, table);
+}
+
 void GfxFilterPixel(DrawPixelInfo& dpi, const ScreenCoordsXY& coords, FilterPaletteID palette)
 {
     GfxFilterRect(dpi, { coords, coords }, palette);
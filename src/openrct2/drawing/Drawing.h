@@ -404,6 +404,16 @@ public:
     uint8_t& operator[](size_t index);
     uint8_t operator[](size_t index) const;
     uint8_t Blend(uint8_t src, uint8_t dst) const;
+
+    /**
+     * Returns the first 256 entries of the map for lookups that skip the bounds check, or nullptr if the map is
+     * shorter than that.
+     */
+    const uint8_t* GetTable() const
+    {
+        return _dataLength >= 256 ? _data : nullptr;
+    }
+
     void Copy(size_t dstIndex, const PaletteMap& src, size_t srcIndex, size_t length);
 };
 
@@ -625,6 +635,22 @@ void MaskFn(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+/**
+ * Draw a run of sprite pixels through a 256 entry palette table, the same as BlitPixel with
+ * BLEND_TRANSPARENT | BLEND_SRC. Pixels stay untouched where the source or the remapped colour is 0.
+ */
+void RemapRunScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT table);
+void RemapRunAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT table);
+void RemapRunFn(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT table);
+
+/**
+ * Filter the destination pixels under a run of sprite pixels through a 256 entry palette table, the same as BlitPixel
+ * with BLEND_TRANSPARENT | BLEND_DST. Used for glass and other translucent sprites.
+ */
+void FilterRunScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT table);
+void FilterRunAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT table);
+void FilterRunFn(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT table);
+
 std::optional<uint32_t> GetPaletteG1Index(colour_t paletteId);
 std::optional<PaletteMap> GetPaletteMapForColour(colour_t paletteId);
 void UpdatePalette(const uint8_t* colours, int32_t start_index, int32_t num_colours);
@@ -38,6 +38,24 @@ enum DRAWING_ENGINE_FLAGS
     DEF_PARALLEL_DRAWING = 1 << 1,
 };
 
+/**
+ * How much of the screen the drawing engine painted again, for engines that only paint changed regions.
+ */
+struct DrawingRepaintStats
+{
+    uint64_t ScreenPixels{};
+
+    // Last frame
+    uint64_t Pixels{};
+    uint32_t Rects{};
+    bool FullRedraw{};
+
+    // All frames so far
+    uint64_t Frames{};
+    uint64_t TotalPixels{};
+    uint64_t FullRedraws{};
+};
+
 struct DrawPixelInfo;
 struct GamePalette;
 
@@ -63,6 +81,7 @@ namespace OpenRCT2::Drawing
         virtual void SetVSync(bool vsync) = 0;
 
         virtual void Invalidate(int32_t left, int32_t top, int32_t right, int32_t bottom) = 0;
+        virtual bool IsInvalidated(int32_t left, int32_t top, int32_t right, int32_t bottom) = 0;
         virtual void BeginDraw() = 0;
         virtual void EndDraw() = 0;
         virtual void PaintWindows() = 0;
@@ -76,6 +95,8 @@ namespace OpenRCT2::Drawing
         virtual DRAWING_ENGINE_FLAGS GetFlags() = 0;
 
         virtual void InvalidateImage(uint32_t image) = 0;
+
+        virtual DrawingRepaintStats GetRepaintStats() = 0;
     };
 
     struct IDrawingEngineFactory
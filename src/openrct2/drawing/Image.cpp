@@ -11,23 +11,56 @@
 
 #include "../Diagnostic.h"
 #include "../OpenRCT2.h"
+#include "../config/Config.h"
 #include "../core/Console.hpp"
 #include "../core/Guard.hpp"
+#include "../paint/Paint.TileCache.h"
 #include "../sprites.h"
 #include "Drawing.h"
 
 #include <algorithm>
+#include <atomic>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 using namespace OpenRCT2;
 
 constexpr uint32_t BASE_IMAGE_ID = SPR_IMAGE_LIST_BEGIN;
 constexpr uint32_t MAX_IMAGES = SPR_IMAGE_LIST_END - BASE_IMAGE_ID;
 
+// Number of frames to wait before trying to load the images of a list again after that failed
+constexpr uint32_t kImageReloadRetryInterval = 100;
+
 static bool _initialised = false;
 static std::list<ImageList> _freeLists;
 static uint32_t _allocatedImageCount;
 
+struct ImageSourceEntry
+{
+    IImageSource* Source{};
+    ImageList List;
+    size_t DataSize{};
+    std::atomic<uint32_t> LastUsed{};
+    std::atomic<bool> Resident{ true };
+    // Set when a released list was drawn, its pixel data is loaded again before the next frame
+    std::atomic<bool> Requested{};
+    bool ReloadFailed{};
+    uint32_t ReloadFailedAt{};
+};
+
+// Image lists that can have their pixel data released, indexed by the slots stored per image.
+static std::vector<std::unique_ptr<ImageSourceEntry>> _imageSources;
+static std::vector<uint32_t> _imageSourceSlots;
+static std::atomic<size_t> _residentImageDataSize;
+static std::mutex _imageSourceMutex;
+
+// Only set while a budget is configured or lists are still released, otherwise nothing needs tracking.
+static std::atomic<bool> _imageCacheEnabled;
+static std::atomic<bool> _imageReloadRequested;
+
 #ifdef DEBUG_LEVEL_1
 static std::list<ImageList> _allocatedLists;
 
@@ -188,7 +221,62 @@ static void FreeImageList(uint32_t baseImageId, uint32_t count)
     _freeLists.push_back({ baseImageId, count });
 }
 
-uint32_t GfxObjectAllocateImages(const G1Element* images, uint32_t count)
+static void SetImageSourceElements(const ImageSourceEntry& entry)
+{
+    const auto* images = entry.Source->GetImages();
+    for (uint32_t i = 0; i < entry.List.Count; i++)
+    {
+        GfxSetG1Element(entry.List.BaseId + i, &images[i]);
+    }
+}
+
+static void RegisterImageSource(IImageSource* source, uint32_t baseImageId, uint32_t count)
+{
+    auto slot = std::find(_imageSources.begin(), _imageSources.end(), nullptr);
+    if (slot == _imageSources.end())
+    {
+        slot = _imageSources.insert(_imageSources.end(), nullptr);
+    }
+
+    auto entry = std::make_unique<ImageSourceEntry>();
+    entry->Source = source;
+    entry->List = ImageList(baseImageId, count);
+    entry->DataSize = source->GetImageDataSize();
+    entry->LastUsed = gCurrentDrawCount;
+    _residentImageDataSize += entry->DataSize;
+    *slot = std::move(entry);
+
+    auto slotNumber = static_cast<uint32_t>(std::distance(_imageSources.begin(), slot)) + 1;
+    auto firstIndex = baseImageId - BASE_IMAGE_ID;
+    if (_imageSourceSlots.size() < firstIndex + count)
+    {
+        _imageSourceSlots.resize(firstIndex + count);
+    }
+    std::fill_n(_imageSourceSlots.begin() + firstIndex, count, slotNumber);
+}
+
+static void UnregisterImageSource(uint32_t baseImageId, uint32_t count)
+{
+    auto firstIndex = baseImageId - BASE_IMAGE_ID;
+    if (firstIndex >= _imageSourceSlots.size() || _imageSourceSlots[firstIndex] == 0)
+        return;
+
+    auto& entry = _imageSources[_imageSourceSlots[firstIndex] - 1];
+    if (entry->Resident)
+    {
+        _residentImageDataSize -= entry->DataSize;
+    }
+    entry = nullptr;
+
+    auto lastIndex = std::min<size_t>(firstIndex + count, _imageSourceSlots.size());
+    std::fill(_imageSourceSlots.begin() + firstIndex, _imageSourceSlots.begin() + lastIndex, 0);
+}
+
+/**
+ * Allocates an image list without setting its elements. Not thread safe, but the storage for the elements is
+ * prepared here so GfxObjectSetImages does not need to grow it.
+ */
+uint32_t GfxObjectReserveImages(uint32_t count)
 {
     if (count == 0 || gOpenRCT2NoGraphics)
     {
@@ -202,14 +290,49 @@ uint32_t GfxObjectAllocateImages(const G1Element* images, uint32_t count)
         return ImageIndexUndefined;
     }
 
-    uint32_t imageId = baseImageId;
+    G1Element g1 = {};
+    for (uint32_t i = 0; i < count; i++)
+    {
+        GfxSetG1Element(baseImageId + i, &g1);
+        DrawingEngineInvalidateImage(baseImageId + i);
+    }
+    return baseImageId;
+}
+
+/**
+ * Sets the elements of a list returned by GfxObjectReserveImages, lists can be set from multiple threads at once.
+ */
+void GfxObjectSetImages(uint32_t baseImageId, const G1Element* images, uint32_t count)
+{
     for (uint32_t i = 0; i < count; i++)
     {
-        GfxSetG1Element(imageId, &images[i]);
-        DrawingEngineInvalidateImage(imageId);
-        imageId++;
+        GfxSetG1Element(baseImageId + i, &images[i]);
+    }
+}
+
+/**
+ * Allows the pixel data of the list to be released while it is not drawn. Not thread safe.
+ */
+void GfxObjectRegisterImageSource(uint32_t baseImageId, uint32_t count, IImageSource* source)
+{
+    if (baseImageId != ImageIndexUndefined && source->GetImageDataSize() != 0)
+    {
+        std::lock_guard<std::mutex> lock(_imageSourceMutex);
+        RegisterImageSource(source, baseImageId, count);
     }
+}
 
+uint32_t GfxObjectAllocateImages(const G1Element* images, uint32_t count, IImageSource* source)
+{
+    uint32_t baseImageId = GfxObjectReserveImages(count);
+    if (baseImageId != ImageIndexUndefined)
+    {
+        GfxObjectSetImages(baseImageId, images, count);
+        if (source != nullptr)
+        {
+            GfxObjectRegisterImageSource(baseImageId, count, source);
+        }
+    }
     return baseImageId;
 }
 
@@ -217,6 +340,11 @@ void GfxObjectFreeImages(uint32_t baseImageId, uint32_t count)
 {
     if (baseImageId != 0 && baseImageId != ImageIndexUndefined)
     {
+        {
+            std::lock_guard<std::mutex> lock(_imageSourceMutex);
+            UnregisterImageSource(baseImageId, count);
+        }
+
         // Zero the G1 elements so we don't have invalid pointers
         // and data lying about
         for (uint32_t i = 0; i < count; i++)
@@ -231,6 +359,151 @@ void GfxObjectFreeImages(uint32_t baseImageId, uint32_t count)
     }
 }
 
+/**
+ * Loads the pixel data of a released image list again, returns false if it has to be tried again later. Must be called
+ * outside of drawing with the image source mutex held.
+ */
+static bool ReloadImageSourceEntry(ImageSourceEntry& entry)
+{
+    if (entry.ReloadFailed && gCurrentDrawCount - entry.ReloadFailedAt < kImageReloadRetryInterval)
+        return false;
+
+    entry.Requested = false;
+    if (!entry.Source->LoadImageData())
+    {
+        LOG_ERROR("Unable to reload images %u to %u.", entry.List.BaseId, entry.List.GetEnd() - 1);
+        entry.ReloadFailed = true;
+        entry.ReloadFailedAt = gCurrentDrawCount;
+        return false;
+    }
+
+    entry.ReloadFailed = false;
+    SetImageSourceElements(entry);
+    entry.DataSize = entry.Source->GetImageDataSize();
+    _residentImageDataSize += entry.DataSize;
+    entry.Resident.store(true, std::memory_order_release);
+    return true;
+}
+
+/**
+ * Loads the lists that were drawn while released, or all released lists. Returns false if any list is still released.
+ */
+static bool ReloadImageSources(bool all)
+{
+    std::lock_guard<std::mutex> lock(_imageSourceMutex);
+    bool anyReloaded = false;
+    bool allResident = true;
+    for (auto& entry : _imageSources)
+    {
+        if (entry == nullptr || entry->Resident)
+            continue;
+
+        if ((all || entry->Requested) && ReloadImageSourceEntry(*entry))
+            anyReloaded = true;
+        else
+            allResident = false;
+    }
+
+    // Painting left out the images that were missing, so paint everything again
+    if (anyReloaded)
+    {
+        PaintTileCacheInvalidate();
+        GfxInvalidateScreen();
+    }
+    return allResident;
+}
+
+/**
+ * Marks the image as drawn this frame. Returns false if its pixel data is released, it is then loaded again before the
+ * next frame. Safe to call from parallel drawing.
+ */
+bool GfxObjectUseImage(ImageIndex imageId)
+{
+    if (!_imageCacheEnabled.load(std::memory_order_relaxed))
+        return true;
+
+    const size_t index = imageId - BASE_IMAGE_ID;
+    if (index >= _imageSourceSlots.size() || _imageSourceSlots[index] == 0)
+        return true;
+
+    auto& entry = *_imageSources[_imageSourceSlots[index] - 1];
+    if (entry.LastUsed.load(std::memory_order_relaxed) != gCurrentDrawCount)
+    {
+        entry.LastUsed.store(gCurrentDrawCount, std::memory_order_relaxed);
+    }
+    if (entry.Resident.load(std::memory_order_acquire))
+        return true;
+
+    entry.Requested.store(true, std::memory_order_relaxed);
+    _imageReloadRequested.store(true, std::memory_order_relaxed);
+    return false;
+}
+
+/**
+ * Loads the pixel data of lists drawn while released, then releases the pixel data of the least recently drawn image
+ * lists until the resident size fits the configured budget. Called once per frame from the game loop, outside of
+ * drawing. Lists drawn in the previous frame are kept.
+ */
+void GfxObjectUpdateImageCache()
+{
+    const size_t budget = static_cast<size_t>(Config::Get().general.ObjectImageMemoryBudget) * 1024 * 1024;
+    if (budget == 0)
+    {
+        // Lookups stop checking for released lists once every list is loaded again
+        if (_imageCacheEnabled && ReloadImageSources(true))
+        {
+            _imageCacheEnabled = false;
+        }
+        return;
+    }
+
+    if (!_imageCacheEnabled)
+    {
+        // Images drawn before the budget was set have stale draw counts, treat them as drawn now
+        for (auto& entry : _imageSources)
+        {
+            if (entry != nullptr)
+            {
+                entry->LastUsed = gCurrentDrawCount;
+            }
+        }
+        _imageCacheEnabled = true;
+    }
+    if (_imageReloadRequested.exchange(false))
+    {
+        ReloadImageSources(false);
+    }
+    if (_residentImageDataSize <= budget)
+        return;
+
+    std::lock_guard<std::mutex> lock(_imageSourceMutex);
+    std::vector<std::pair<uint32_t, ImageSourceEntry*>> candidates;
+    for (auto& entry : _imageSources)
+    {
+        if (entry == nullptr || !entry->Resident)
+            continue;
+
+        const auto lastUsed = entry->LastUsed.load(std::memory_order_relaxed);
+        if (gCurrentDrawCount - lastUsed > 1)
+        {
+            candidates.emplace_back(lastUsed, entry.get());
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    for (const auto& candidate : candidates)
+    {
+        if (_residentImageDataSize <= budget)
+            break;
+
+        auto* entry = candidate.second;
+        entry->Source->UnloadImageData();
+        SetImageSourceElements(*entry);
+        entry->Resident = false;
+        _residentImageDataSize -= entry->DataSize;
+    }
+}
+
 void GfxObjectCheckAllImagesFreed()
 {
     if (_allocatedImageCount != 0)
@@ -55,8 +55,26 @@ constexpr bool operator!=(const ImageList& lhs, const ImageList& rhs)
     return !(lhs == rhs);
 }
 
-uint32_t GfxObjectAllocateImages(const G1Element* images, uint32_t count);
+/**
+ * Owner of an allocated image list whose pixel data can be released while it is not drawn and loaded again on demand.
+ */
+struct IImageSource
+{
+    virtual ~IImageSource() = default;
+
+    virtual const G1Element* GetImages() const = 0;
+    virtual size_t GetImageDataSize() const = 0;
+    virtual bool LoadImageData() = 0;
+    virtual void UnloadImageData() = 0;
+};
+
+uint32_t GfxObjectAllocateImages(const G1Element* images, uint32_t count, IImageSource* source = nullptr);
+uint32_t GfxObjectReserveImages(uint32_t count);
+void GfxObjectSetImages(uint32_t baseImageId, const G1Element* images, uint32_t count);
+void GfxObjectRegisterImageSource(uint32_t baseImageId, uint32_t count, IImageSource* source);
 void GfxObjectFreeImages(uint32_t baseImageId, uint32_t count);
+bool GfxObjectUseImage(ImageIndex imageId);
+void GfxObjectUpdateImageCache();
 void GfxObjectCheckAllImagesFreed();
 size_t ImageListGetUsedCount();
 size_t ImageListGetMaximum();
@@ -133,6 +133,16 @@ bool DrawingEngineHasDirtyOptimisations()
     return result;
 }
 
+bool DrawingEngineIsInvalidated(int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    auto drawingEngine = GetDrawingEngine();
+    if (drawingEngine != nullptr)
+    {
+        return drawingEngine->IsInvalidated(left, top, right, bottom);
+    }
+    return false;
+}
+
 void DrawingEngineInvalidateImage(uint32_t image)
 {
     auto drawingEngine = GetDrawingEngine();
@@ -142,6 +152,16 @@ void DrawingEngineInvalidateImage(uint32_t image)
     }
 }
 
+DrawingRepaintStats DrawingEngineGetRepaintStats()
+{
+    auto drawingEngine = GetDrawingEngine();
+    if (drawingEngine != nullptr)
+    {
+        return drawingEngine->GetRepaintStats();
+    }
+    return {};
+}
+
 void DrawingEngineSetVSync(bool vsync)
 {
     auto drawingEngine = GetDrawingEngine();
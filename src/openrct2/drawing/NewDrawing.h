@@ -12,6 +12,7 @@
 #include "../localisation/StringIdType.h"
 
 struct DrawPixelInfo;
+struct DrawingRepaintStats;
 struct GamePalette;
 enum class DrawingEngine : int32_t;
 
@@ -27,5 +28,7 @@ void DrawingEngineDispose();
 
 DrawPixelInfo& DrawingEngineGetDpi();
 bool DrawingEngineHasDirtyOptimisations();
+bool DrawingEngineIsInvalidated(int32_t left, int32_t top, int32_t right, int32_t bottom);
 void DrawingEngineInvalidateImage(uint32_t image);
+DrawingRepaintStats DrawingEngineGetRepaintStats();
 void DrawingEngineSetVSync(bool vsync);
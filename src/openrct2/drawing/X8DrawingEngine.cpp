@@ -127,7 +127,6 @@ X8DrawingEngine::X8DrawingEngine([[maybe_unused]] const std::shared_ptr<Ui::IUiC
 X8DrawingEngine::~X8DrawingEngine()
 {
     delete _drawingContext;
-    delete[] _dirtyGrid.Blocks;
     delete[] _bits;
 }
 
@@ -152,35 +151,17 @@ void X8DrawingEngine::SetVSync([[maybe_unused]] bool vsync)
 }
 
 void X8DrawingEngine::Invalidate(int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    _dirtyRects.Add({ left, top, right, bottom });
+}
+
+bool X8DrawingEngine::IsInvalidated(int32_t left, int32_t top, int32_t right, int32_t bottom)
 {
     left = std::max(left, 0);
     top = std::max(top, 0);
     right = std::min(right, static_cast<int32_t>(_width));
     bottom = std::min(bottom, static_cast<int32_t>(_height));
-
-    if (left >= right)
-        return;
-    if (top >= bottom)
-        return;
-
-    right--;
-    bottom--;
-
-    left >>= _dirtyGrid.BlockShiftX;
-    right >>= _dirtyGrid.BlockShiftX;
-    top >>= _dirtyGrid.BlockShiftY;
-    bottom >>= _dirtyGrid.BlockShiftY;
-
-    uint32_t dirtyBlockColumns = _dirtyGrid.BlockColumns;
-    uint8_t* screenDirtyBlocks = _dirtyGrid.Blocks;
-    for (int16_t y = top; y <= bottom; y++)
-    {
-        uint32_t yOffset = y * dirtyBlockColumns;
-        for (int16_t x = left; x <= right; x++)
-        {
-            screenDirtyBlocks[yOffset + x] = 0xFF;
-        }
-    }
+    return _dirtyRects.Contains({ left, top, right, bottom });
 }
 
 void X8DrawingEngine::BeginDraw()
@@ -206,11 +187,23 @@ void X8DrawingEngine::PaintWindows()
 {
     WindowResetVisibilities();
 
+    _repaintStats.ScreenPixels = static_cast<uint64_t>(_width) * _height;
+    _repaintStats.Pixels = 0;
+    _repaintStats.Rects = 0;
+    _repaintStats.FullRedraw = false;
+
     // Redraw dirty regions before updating the viewports, otherwise
     // when viewports get panned, they copy dirty pixels
-    DrawAllDirtyBlocks();
+    DrawAllDirtyRects();
     WindowUpdateAllViewports();
-    DrawAllDirtyBlocks();
+    DrawAllDirtyRects();
+
+    _repaintStats.Frames++;
+    _repaintStats.TotalPixels += _repaintStats.Pixels;
+    if (_repaintStats.FullRedraw)
+    {
+        _repaintStats.FullRedraws++;
+    }
 }
 
 void X8DrawingEngine::PaintWeather()
@@ -283,6 +276,11 @@ void X8DrawingEngine::InvalidateImage([[maybe_unused]] uint32_t image)
     // Not applicable for this engine
 }
 
+DrawingRepaintStats X8DrawingEngine::GetRepaintStats()
+{
+    return _repaintStats;
+}
+
 DrawPixelInfo* X8DrawingEngine::GetDPI()
 {
     return &_bitsDPI;
@@ -359,97 +357,40 @@ void X8DrawingEngine::ConfigureDirtyGrid()
     _dirtyGrid.BlockColumns = (_width >> _dirtyGrid.BlockShiftX) + 1;
     _dirtyGrid.BlockRows = (_height >> _dirtyGrid.BlockShiftY) + 1;
 
-    delete[] _dirtyGrid.Blocks;
-    _dirtyGrid.Blocks = new uint8_t[_dirtyGrid.BlockColumns * _dirtyGrid.BlockRows];
-}
-
-void X8DrawingEngine::DrawAllDirtyBlocks()
-{
-    // TODO: For optimal performance it is currently limited to a single column.
-    // The optimal approach would be to extract all dirty regions as rectangles not including
-    // parts that are not marked dirty and have the grid more fine grained.
-    // A situation like following:
-    //
-    //   0 1 2 3 4 5 6 7 8 9
-    //   1 - - - - - - - - -
-    //   2 - x x x x - - - -
-    //   3 - x x - - - - - -
-    //   4 - - - - - - - - -
-    //   5 - - - - - - - - -
-    //   6 - - - - - - - - -
-    //   7 - - - - - - - - -
-    //   8 - - - - - - - - -
-    //   9 - - - - - - - - -
-    //
-    // Would currently redraw {2,2} to {3,5} where {3,4} and {3,5} are not dirty. Choosing to do this
-    // per column eliminates this issue but limits it to rendering just a single column at a time.
-
-    for (uint32_t x = 0; x < _dirtyGrid.BlockColumns; x++)
-    {
-        for (uint32_t y = 0; y < _dirtyGrid.BlockRows; y++)
-        {
-            uint32_t yOffset = y * _dirtyGrid.BlockColumns;
-            if (_dirtyGrid.Blocks[yOffset + x] == 0)
-            {
-                continue;
-            }
-
-            // See comment above as to why this is 1.
-            const uint32_t columns = 1;
-
-            // Check rows
-            auto rows = GetNumDirtyRows(x, y, columns);
-            DrawDirtyBlocks(x, y, columns, rows);
-        }
-    }
+    _dirtyRects.Resize(_width, _height);
 }
 
-uint32_t X8DrawingEngine::GetNumDirtyRows(const uint32_t x, const uint32_t y, const uint32_t columns)
+void X8DrawingEngine::DrawAllDirtyRects()
 {
-    uint32_t yy = y;
+    _repaintStats.FullRedraw |= _dirtyRects.IsFull();
 
-    for (yy = y; yy < _dirtyGrid.BlockRows; yy++)
+    // Regions invalidated while drawing are drawn by the next call
+    const auto rects = _dirtyRects.GetRects();
+    _dirtyRects.Clear();
+    for (const auto& rect : rects)
     {
-        uint32_t yyOffset = yy * _dirtyGrid.BlockColumns;
-        for (uint32_t xx = x; xx < x + columns; xx++)
-        {
-            if (_dirtyGrid.Blocks[yyOffset + xx] == 0)
-            {
-                return yy - y;
-            }
-        }
+        DrawDirtyRect(rect);
     }
-    return yy - y;
 }
 
-void X8DrawingEngine::DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows)
+void X8DrawingEngine::DrawDirtyRect(const ScreenRect& rect)
 {
-    uint32_t dirtyBlockColumns = _dirtyGrid.BlockColumns;
-    uint8_t* screenDirtyBlocks = _dirtyGrid.Blocks;
-
-    // Unset dirty blocks
-    for (uint32_t top = y; top < y + rows; top++)
-    {
-        uint32_t topOffset = top * dirtyBlockColumns;
-        for (uint32_t left = x; left < x + columns; left++)
-        {
-            screenDirtyBlocks[topOffset + left] = 0;
-        }
-    }
-
-    // Determine region in pixels
-    uint32_t left = std::max<uint32_t>(0, x * _dirtyGrid.BlockWidth);
-    uint32_t top = std::max<uint32_t>(0, y * _dirtyGrid.BlockHeight);
-    uint32_t right = std::min(_width, left + (columns * _dirtyGrid.BlockWidth));
-    uint32_t bottom = std::min(_height, top + (rows * _dirtyGrid.BlockHeight));
-    if (right <= left || bottom <= top)
+    if (rect.GetWidth() <= 0 || rect.GetHeight() <= 0)
     {
         return;
     }
 
-    // Draw region
+    _repaintStats.Pixels += static_cast<uint64_t>(rect.GetWidth()) * rect.GetHeight();
+    _repaintStats.Rects++;
+
+    // Report the grid blocks the region touches
+    uint32_t x = rect.GetLeft() >> _dirtyGrid.BlockShiftX;
+    uint32_t y = rect.GetTop() >> _dirtyGrid.BlockShiftY;
+    uint32_t columns = ((rect.GetRight() - 1) >> _dirtyGrid.BlockShiftX) - x + 1;
+    uint32_t rows = ((rect.GetBottom() - 1) >> _dirtyGrid.BlockShiftY) - y + 1;
     OnDrawDirtyBlock(x, y, columns, rows);
-    WindowDrawAll(_bitsDPI, left, top, right, bottom);
+
+    WindowDrawAll(_bitsDPI, rect.GetLeft(), rect.GetTop(), rect.GetRight(), rect.GetBottom());
 }
 
 #ifdef __WARN_SUGGEST_FINAL_METHODS__
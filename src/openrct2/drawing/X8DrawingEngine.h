@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "DirtyRects.h"
 #include "IDrawingContext.h"
 #include "IDrawingEngine.h"
 
@@ -33,7 +34,6 @@ namespace OpenRCT2
             uint32_t BlockHeight;
             uint32_t BlockColumns;
             uint32_t BlockRows;
-            uint8_t* Blocks;
         };
 
         class X8WeatherDrawer final : public IWeatherDrawer
@@ -74,6 +74,8 @@ namespace OpenRCT2
             uint8_t* _bits = nullptr;
 
             DirtyGrid _dirtyGrid = {};
+            DirtyRects _dirtyRects;
+            DrawingRepaintStats _repaintStats = {};
 
             DrawPixelInfo _bitsDPI = {};
 
@@ -100,6 +102,7 @@ namespace OpenRCT2
             void SetPalette(const GamePalette& palette) override;
             void SetVSync(bool vsync) override;
             void Invalidate(int32_t left, int32_t top, int32_t right, int32_t bottom) override;
+            bool IsInvalidated(int32_t left, int32_t top, int32_t right, int32_t bottom) override;
             void BeginDraw() override;
             void EndDraw() override;
             void PaintWindows() override;
@@ -110,6 +113,7 @@ namespace OpenRCT2
             DrawPixelInfo* GetDrawingPixelInfo() override;
             DRAWING_ENGINE_FLAGS GetFlags() override;
             void InvalidateImage(uint32_t image) override;
+            DrawingRepaintStats GetRepaintStats() override;
 
             DrawPixelInfo* GetDPI();
 
@@ -119,9 +123,8 @@ namespace OpenRCT2
 
         private:
             void ConfigureDirtyGrid();
-            void DrawAllDirtyBlocks();
-            uint32_t GetNumDirtyRows(const uint32_t x, const uint32_t y, const uint32_t columns);
-            void DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows);
+            void DrawAllDirtyRects();
+            void DrawDirtyRect(const ScreenRect& rect);
         };
 #ifdef __WARN_SUGGEST_FINAL_TYPES__
 #    pragma GCC diagnostic pop
@@ -0,0 +1,263 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ZoomedSpriteCache.h"
+
+#include "../sprites.h"
+
+#include <algorithm>
+#include <mutex>
+#include <tuple>
+
+using namespace OpenRCT2::Drawing;
+
+std::unique_ptr<ZoomedSprite> ZoomedSprite::Create(const G1Element& source, ZoomLevel zoom, int32_t phaseX, int32_t phaseY)
+{
+    auto sprite = std::make_unique<ZoomedSprite>();
+    sprite->Source = source.offset;
+    sprite->Zoom = zoom;
+    sprite->PhaseX = phaseX;
+    sprite->PhaseY = phaseY;
+
+    const auto step = zoom.ApplyTo(1);
+    const auto width = std::max(0, (source.width - phaseX + step - 1) / step);
+    const auto height = std::max(0, (source.height - phaseY + step - 1) / step);
+    if (width == 0 || height == 0)
+        return sprite;
+
+    auto& data = sprite->Data;
+    data.resize(static_cast<size_t>(height) * 2);
+    std::vector<uint8_t> row(width);
+    for (int32_t y = 0; y < height; y++)
+    {
+        // Pick the sampled pixels out of the source row, colour 0 stays transparent
+        std::fill(row.begin(), row.end(), 0);
+        const auto srcY = phaseY + y * step;
+        const auto* nextRun = source.offset + (source.offset[srcY * 2] | (source.offset[srcY * 2 + 1] << 8));
+        auto isEndOfLine = false;
+        while (!isEndOfLine)
+        {
+            const auto* src = nextRun;
+            auto dataSize = *src++;
+            auto firstPixelX = *src++;
+            isEndOfLine = (dataSize & 0x80) != 0;
+            dataSize &= 0x7F;
+            nextRun = src + dataSize;
+
+            for (int32_t i = 0; i < dataSize; i++)
+            {
+                const auto x = firstPixelX + i - phaseX;
+                if (x >= 0 && x % step == 0 && x / step < width)
+                {
+                    row[x / step] = src[i];
+                }
+            }
+        }
+
+        // Row offsets are 16 bit, a sprite this large is drawn without the cache
+        if (data.size() > 0xFFFF)
+        {
+            data.clear();
+            data.shrink_to_fit();
+            return sprite;
+        }
+        data[y * 2] = static_cast<uint8_t>(data.size());
+        data[y * 2 + 1] = static_cast<uint8_t>(data.size() >> 8);
+
+        auto lastRun = data.size();
+        for (int32_t x = 0; x < width;)
+        {
+            if (row[x] == 0)
+            {
+                x++;
+                continue;
+            }
+
+            int32_t length = 1;
+            while (x + length < width && row[x + length] != 0 && length < 0x7F)
+            {
+                length++;
+            }
+            lastRun = data.size();
+            data.push_back(static_cast<uint8_t>(length));
+            data.push_back(static_cast<uint8_t>(x));
+            data.insert(data.end(), row.begin() + x, row.begin() + x + length);
+            x += length;
+        }
+
+        // Rows without pixels still need a run to end the line
+        if (lastRun == data.size())
+        {
+            data.push_back(0);
+            data.push_back(0);
+        }
+        data[lastRun] |= 0x80;
+    }
+
+    data.shrink_to_fit();
+    sprite->Element.offset = data.data();
+    sprite->Element.width = static_cast<int16_t>(width);
+    sprite->Element.height = static_cast<int16_t>(height);
+    sprite->Element.flags = G1_FLAG_RLE_COMPRESSION;
+    return sprite;
+}
+
+ZoomedSpriteCache::ZoomedSpriteCache(size_t budget)
+    : _budget(budget)
+{
+}
+
+std::shared_ptr<const ZoomedSprite> ZoomedSpriteCache::Get(
+    ImageIndex imageIndex, const G1Element& source, ZoomLevel zoom, int32_t phaseX, int32_t phaseY)
+{
+    if (imageIndex == SPR_TEMP || (imageIndex >= SPR_SCROLLING_TEXT_START && imageIndex < SPR_SCROLLING_TEXT_END))
+        return nullptr;
+
+    // Looking up small sprites, like peeps, costs more than walking their few runs
+    if (source.width * source.height < kMinPixels)
+        return nullptr;
+
+    const auto matches = [&](const std::shared_ptr<ZoomedSprite>& sprite) {
+        return sprite->Source == source.offset && sprite->Zoom == zoom && sprite->PhaseX == phaseX
+            && sprite->PhaseY == phaseY;
+    };
+    const auto usable = [](std::shared_ptr<const ZoomedSprite> sprite) {
+        return sprite->Element.offset != nullptr ? sprite : nullptr;
+    };
+
+    {
+        std::shared_lock lock(_mutex);
+        auto it = _sprites.find(imageIndex);
+        if (it != _sprites.end())
+        {
+            auto spriteIt = std::find_if(it->second.begin(), it->second.end(), matches);
+            if (spriteIt != it->second.end())
+            {
+                // Only written when it changes, so the threads drawing the same sprite do not fight over the line
+                const auto now = _clock.load(std::memory_order_relaxed);
+                if ((*spriteIt)->LastUsed.load(std::memory_order_relaxed) != now)
+                {
+                    (*spriteIt)->LastUsed.store(now, std::memory_order_relaxed);
+                }
+                return usable(*spriteIt);
+            }
+        }
+    }
+
+    std::shared_ptr<ZoomedSprite> sprite = ZoomedSprite::Create(source, zoom, phaseX, phaseY);
+    sprite->LastUsed = _clock.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    std::unique_lock lock(_mutex);
+    auto& sprites = _sprites[imageIndex];
+
+    // Another thread may have built the same sprite in the meantime
+    auto spriteIt = std::find_if(sprites.begin(), sprites.end(), matches);
+    if (spriteIt != sprites.end())
+    {
+        return usable(*spriteIt);
+    }
+
+    // Sprites built from image data that has been replaced are of no more use
+    auto staleIt = std::remove_if(sprites.begin(), sprites.end(), [&source](const std::shared_ptr<ZoomedSprite>& stale) {
+        return stale->Source != source.offset;
+    });
+    for (auto it = staleIt; it != sprites.end(); it++)
+    {
+        _memoryUsage -= (*it)->GetMemoryUsage();
+        _count--;
+    }
+    sprites.erase(staleIt, sprites.end());
+
+    sprites.push_back(sprite);
+    _memoryUsage += sprite->GetMemoryUsage();
+    _count++;
+    if (_memoryUsage > _budget)
+    {
+        Trim();
+    }
+    return usable(sprite);
+}
+
+void ZoomedSpriteCache::Invalidate(ImageIndex imageIndex)
+{
+    std::unique_lock lock(_mutex);
+    auto it = _sprites.find(imageIndex);
+    if (it == _sprites.end())
+        return;
+
+    for (const auto& sprite : it->second)
+    {
+        _memoryUsage -= sprite->GetMemoryUsage();
+        _count--;
+    }
+    _sprites.erase(it);
+}
+
+void ZoomedSpriteCache::Clear()
+{
+    std::unique_lock lock(_mutex);
+    _sprites.clear();
+    _memoryUsage = 0;
+    _count = 0;
+}
+
+size_t ZoomedSpriteCache::GetMemoryUsage() const
+{
+    std::shared_lock lock(_mutex);
+    return _memoryUsage;
+}
+
+size_t ZoomedSpriteCache::GetCount() const
+{
+    std::shared_lock lock(_mutex);
+    return _count;
+}
+
+/**
+ * Drops the least recently used sprites until a quarter of the budget is free again, so a full cache is not trimmed
+ * on every new sprite. Must be called with the lock held.
+ */
+void ZoomedSpriteCache::Trim()
+{
+    std::vector<std::tuple<uint32_t, ImageIndex, ZoomedSprite*>> byAge;
+    byAge.reserve(_count);
+    for (const auto& [imageIndex, sprites] : _sprites)
+    {
+        for (const auto& sprite : sprites)
+        {
+            byAge.emplace_back(sprite->LastUsed.load(std::memory_order_relaxed), imageIndex, sprite.get());
+        }
+    }
+    std::sort(byAge.begin(), byAge.end());
+
+    const auto target = _budget / 4 * 3;
+    for (const auto& [lastUsed, imageIndex, oldest] : byAge)
+    {
+        if (_memoryUsage <= target)
+            break;
+
+        auto& sprites = _sprites[imageIndex];
+        auto it = std::find_if(sprites.begin(), sprites.end(), [oldest](const std::shared_ptr<ZoomedSprite>& sprite) {
+            return sprite.get() == oldest;
+        });
+        _memoryUsage -= oldest->GetMemoryUsage();
+        _count--;
+        sprites.erase(it);
+        if (sprites.empty())
+        {
+            _sprites.erase(imageIndex);
+        }
+    }
+}
+
+ZoomedSpriteCache& OpenRCT2::Drawing::GetZoomedSpriteCache()
+{
+    static ZoomedSpriteCache cache;
+    return cache;
+}
@@ -0,0 +1,89 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../interface/ZoomLevel.h"
+#include "Drawing.h"
+#include "ImageIndexType.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace OpenRCT2::Drawing
+{
+    /**
+     * An RLE sprite reduced for a zoom level. Zoomed out, a sprite is drawn from every zoom'th pixel of every zoom'th
+     * row, counted from where the sprite is clipped, so the phase is the first sampled column and row.
+     */
+    struct ZoomedSprite
+    {
+        G1Element Element;
+        std::vector<uint8_t> Data;
+        const uint8_t* Source{};
+        ZoomLevel Zoom;
+        int32_t PhaseX{};
+        int32_t PhaseY{};
+        mutable std::atomic<uint32_t> LastUsed{};
+
+        /**
+         * Samples the sprite like DrawRLESpriteMinify does and encodes the result as RLE again. Pixels of colour 0 are
+         * dropped from the runs as they are never drawn when zoomed out. Element.offset is nullptr if the result does not
+         * fit the RLE format.
+         */
+        static std::unique_ptr<ZoomedSprite> Create(const G1Element& source, ZoomLevel zoom, int32_t phaseX, int32_t phaseY);
+
+        size_t GetMemoryUsage() const
+        {
+            return sizeof(ZoomedSprite) + Data.capacity();
+        }
+    };
+
+    /**
+     * Zoomed sprites built on first use and shared between the paint threads. When the budget is exceeded the
+     * sprites that have gone unused the longest are dropped.
+     */
+    class ZoomedSpriteCache
+    {
+    public:
+        static constexpr size_t kDefaultBudget = 16 * 1024 * 1024;
+        static constexpr int32_t kMinPixels = 2048;
+
+        explicit ZoomedSpriteCache(size_t budget = kDefaultBudget);
+
+        /**
+         * Returns the zoomed sprite, or nullptr if the image should be drawn without the cache. Small images and images
+         * that change every frame, like the scrolling text, are never cached.
+         */
+        std::shared_ptr<const ZoomedSprite> Get(
+            ImageIndex imageIndex, const G1Element& source, ZoomLevel zoom, int32_t phaseX, int32_t phaseY);
+
+        void Invalidate(ImageIndex imageIndex);
+        void Clear();
+
+        size_t GetMemoryUsage() const;
+        size_t GetCount() const;
+
+    private:
+        size_t _budget;
+        size_t _memoryUsage{};
+        size_t _count{};
+        std::atomic<uint32_t> _clock{};
+        mutable std::shared_mutex _mutex;
+        std::unordered_map<ImageIndex, std::vector<std::shared_ptr<ZoomedSprite>>> _sprites;
+
+        void Trim();
+    };
+
+    ZoomedSpriteCache& GetZoomedSpriteCache();
+} // namespace OpenRCT2::Drawing
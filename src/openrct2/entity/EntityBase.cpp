@@ -11,6 +11,7 @@
 
 #include "../core/DataSerialiser.h"
 #include "../interface/Viewport.h"
+#include "EntityRegistry.h"
 
 using namespace OpenRCT2;
 
@@ -30,10 +31,13 @@ void EntityBase::SetLocation(const CoordsXYZ& newLocation)
     x = newLocation.x;
     y = newLocation.y;
     z = newLocation.z;
+    EntityInvalidateChecksum(this);
 }
 
 void EntityBase::Invalidate()
 {
+    EntityInvalidateChecksum(this);
+
     if (x == kLocationNull)
         return;
 
@@ -32,8 +32,10 @@
 #include "MoneyEffect.h"
 #include "Particle.h"
 
+#include <array>
 #include <cassert>
 #include <cmath>
+#include <cstring>
 #include <iterator>
 #include <numeric>
 #include <vector>
@@ -45,6 +47,16 @@ static std::vector<EntityId> _freeIdList;
 
 static bool _entityFlashingList[MAX_ENTITIES];
 
+// Bumped whenever a slot is reset, so a stale pointer to a reused slot can be told apart from the new entity
+static std::array<uint32_t, MAX_ENTITIES> _entityGenerations;
+
+// Per entity hashes, combined by wrapping addition so they can be replaced individually in any order.
+static std::array<uint64_t, MAX_ENTITIES> _entityChecksums;
+static bool _entityChecksumDirty[MAX_ENTITIES];
+static std::vector<EntityId> _entityChecksumDirtyList;
+static bool _entityChecksumAllDirty = true;
+static uint64_t _entitiesChecksum = 0;
+
 constexpr const uint32_t SPATIAL_INDEX_SIZE = (kMaximumMapSizeTechnical * kMaximumMapSizeTechnical) + 1;
 constexpr uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
 
@@ -181,10 +193,12 @@ void ResetAllEntities()
         spr->Id = EntityId::FromUnderlying(i);
 
         _entityFlashingList[i] = false;
+        _entityGenerations[i]++;
     }
     ResetEntityLists();
     ResetFreeIds();
     ResetEntitySpatialIndices();
+    InvalidateAllEntitiesChecksum();
 }
 
 static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc);
@@ -226,7 +240,7 @@ template<typename... T> void NetworkSerialiseEntityTypes(DataSerialiser& ds)
     (NetworkSerialseEntityType<T>(ds), ...);
 }
 
-EntitiesChecksum GetAllEntitiesChecksum()
+EntitiesChecksum GetAllEntitiesChecksumLegacy()
 {
     EntitiesChecksum checksum{};
 
@@ -236,6 +250,93 @@ EntitiesChecksum GetAllEntitiesChecksum()
 
     return checksum;
 }
+
+static uint64_t ComputeEntityChecksum(EntityBase& entity)
+{
+    std::array<std::byte, 20> raw{};
+    OpenRCT2::ChecksumStream ms(raw);
+    DataSerialiser ds(true, ms);
+    switch (entity.Type)
+    {
+        case EntityType::Guest:
+            static_cast<Guest&>(entity).Serialise(ds);
+            break;
+        case EntityType::Staff:
+            static_cast<Staff&>(entity).Serialise(ds);
+            break;
+        case EntityType::Vehicle:
+            static_cast<Vehicle&>(entity).Serialise(ds);
+            break;
+        case EntityType::Litter:
+            static_cast<Litter&>(entity).Serialise(ds);
+            break;
+        default:
+            return 0;
+    }
+
+    uint64_t hash{};
+    std::memcpy(&hash, raw.data(), sizeof(hash));
+
+    // Mix the bits, summing raw FNV hashes of near identical entities would cancel out differences.
+    hash ^= hash >> 30;
+    hash *= 0xbf58476d1ce4e5b9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+    return hash;
+}
+
+static void UpdateEntitiesChecksum()
+{
+    if (_entityChecksumAllDirty)
+    {
+        _entityChecksums.fill(0);
+        _entitiesChecksum = 0;
+        for (auto type : { EntityType::Guest, EntityType::Staff, EntityType::Vehicle, EntityType::Litter })
+        {
+            for (auto id : GetEntityList(type))
+            {
+                auto* entity = GetEntity(id);
+                if (entity == nullptr)
+                    continue;
+
+                const auto hash = ComputeEntityChecksum(*entity);
+                _entityChecksums[id.ToUnderlying()] = hash;
+                _entitiesChecksum += hash;
+            }
+        }
+    }
+    else
+    {
+        for (auto id : _entityChecksumDirtyList)
+        {
+            auto* entity = GetEntity(id);
+            if (entity == nullptr)
+                continue;
+
+            auto& hash = _entityChecksums[id.ToUnderlying()];
+            _entitiesChecksum -= hash;
+            hash = ComputeEntityChecksum(*entity);
+            _entitiesChecksum += hash;
+        }
+    }
+
+    for (auto id : _entityChecksumDirtyList)
+    {
+        _entityChecksumDirty[id.ToUnderlying()] = false;
+    }
+    _entityChecksumDirtyList.clear();
+    _entityChecksumAllDirty = false;
+}
+
+EntitiesChecksum GetAllEntitiesChecksum()
+{
+    UpdateEntitiesChecksum();
+
+    EntitiesChecksum checksum{};
+    std::memcpy(checksum.raw.data(), &_entitiesChecksum, sizeof(_entitiesChecksum));
+    return checksum;
+}
 #else
 
 EntitiesChecksum GetAllEntitiesChecksum()
@@ -243,13 +344,44 @@ EntitiesChecksum GetAllEntitiesChecksum()
     return EntitiesChecksum{};
 }
 
+EntitiesChecksum GetAllEntitiesChecksumLegacy()
+{
+    return EntitiesChecksum{};
+}
+
 #endif // DISABLE_NETWORK
 
+/**
+ * Marks the entity to be re-hashed on the next call to GetAllEntitiesChecksum. Must be called whenever
+ * the entity may have changed.
+ */
+void EntityInvalidateChecksum(const EntityBase* entity)
+{
+    if (_entityChecksumAllDirty)
+        return;
+
+    const auto idx = entity->Id.ToUnderlying();
+    if (idx >= MAX_ENTITIES || _entityChecksumDirty[idx])
+        return;
+
+    _entityChecksumDirty[idx] = true;
+    _entityChecksumDirtyList.push_back(entity->Id);
+}
+
+/**
+ * Forces every entity to be re-hashed on the next call to GetAllEntitiesChecksum.
+ */
+void InvalidateAllEntitiesChecksum()
+{
+    _entityChecksumAllDirty = true;
+}
+
 static void EntityReset(EntityBase* entity)
 {
     // Need to retain how the sprite is linked in lists
     auto entityIndex = entity->Id;
     _entityFlashingList[entityIndex.ToUnderlying()] = false;
+    _entityGenerations[entityIndex.ToUnderlying()]++;
 
     Entity_t* tempEntity = reinterpret_cast<Entity_t*>(entity);
     *tempEntity = Entity_t();
@@ -303,6 +435,7 @@ static void PrepareNewEntity(EntityBase* base, const EntityType type)
 
     base->Type = type;
     AddToEntityList(base);
+    EntityInvalidateChecksum(base);
 
     base->x = kLocationNull;
     base->y = kLocationNull;
@@ -510,6 +643,7 @@ void EntityRemove(EntityBase* entity)
 
     EntitySpatialRemove(entity);
     EntityReset(entity);
+    EntityInvalidateChecksum(entity);
 }
 
 /**
@@ -551,3 +685,9 @@ bool EntityGetFlashing(EntityBase* entity)
     assert(entity->Id.ToUnderlying() < MAX_ENTITIES);
     return _entityFlashingList[entity->Id.ToUnderlying()];
 }
+
+uint32_t EntityGetGeneration(const EntityBase* entity)
+{
+    assert(entity->Id.ToUnderlying() < MAX_ENTITIES);
+    return _entityGenerations[entity->Id.ToUnderlying()];
+}
@@ -76,6 +76,10 @@ struct EntitiesChecksum
 };
 #pragma pack(pop)
 EntitiesChecksum GetAllEntitiesChecksum();
+EntitiesChecksum GetAllEntitiesChecksumLegacy();
+void EntityInvalidateChecksum(const EntityBase* entity);
+void InvalidateAllEntitiesChecksum();
 
 void EntitySetFlashing(EntityBase* entity, bool flashing);
 bool EntityGetFlashing(EntityBase* entity);
+uint32_t EntityGetGeneration(const EntityBase* entity);
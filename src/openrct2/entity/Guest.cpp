@@ -900,6 +900,8 @@ void Guest::UpdateConsumptionMotives()
 
 void Guest::Tick128UpdateGuest(uint32_t index)
 {
+    EntityInvalidateChecksum(this);
+
     const auto currentTicks = GetGameState().CurrentTicks;
     if ((index & 0x1FF) != (currentTicks & 0x1FF))
     {
@@ -2494,6 +2496,7 @@ static void PeepChooseSeatFromCar(Peep* peep, const Ride& ride, Vehicle* vehicle
     }
     peep->CurrentSeat = chosen_seat;
     vehicle->next_free_seat++;
+    EntityInvalidateChecksum(vehicle);
 
     vehicle->peep[peep->CurrentSeat] = peep->Id;
     vehicle->peep_tshirt_colours[peep->CurrentSeat] = peep->TshirtColour;
@@ -3976,6 +3979,7 @@ void Guest::UpdateRideFreeVehicleCheck()
     if (rideEntry->Cars[0].flags & CAR_ENTRY_FLAG_MINI_GOLF)
     {
         vehicle->mini_golf_flags &= ~MiniGolfFlag::Flag5;
+        EntityInvalidateChecksum(vehicle);
 
         for (size_t i = 0; i < ride->NumTrains; ++i)
         {
@@ -4039,6 +4043,7 @@ void Guest::UpdateRideFreeVehicleCheck()
 
     vehicle->next_free_seat--;
     vehicle->peep[CurrentSeat] = EntityId::GetNull();
+    EntityInvalidateChecksum(vehicle);
 
     PeepUpdateRideNoFreeVehicleRejoinQueue(this, *ride);
 }
@@ -6966,6 +6971,9 @@ void Guest::InsertNewThought(PeepThoughtType thought_type, RideId rideId)
  */
 void Guest::InsertNewThought(PeepThoughtType thoughtType, uint16_t thoughtArguments)
 {
+    // Vehicles and rides add thoughts to guests other than the one being updated
+    EntityInvalidateChecksum(this);
+
     PeepActionType newAction = PeepThoughtToActionMap[EnumValue(thoughtType)].action;
     if (newAction != PeepActionType::Walking && IsActionInterruptable())
     {
@@ -7508,6 +7516,7 @@ void Guest::RemoveFromQueue()
         if (Id == otherGuest->GuestNextInQueue)
         {
             otherGuest->GuestNextInQueue = GuestNextInQueue;
+            EntityInvalidateChecksum(otherGuest);
             return;
         }
     }
@@ -7521,21 +7530,25 @@ uint64_t Guest::GetItemFlags() const
 void Guest::SetItemFlags(uint64_t itemFlags)
 {
     ItemFlags = itemFlags;
+    EntityInvalidateChecksum(this);
 }
 
 void Guest::RemoveAllItems()
 {
     ItemFlags = 0;
+    EntityInvalidateChecksum(this);
 }
 
 void Guest::RemoveItem(ShopItem item)
 {
     ItemFlags &= ~EnumToFlag(item);
+    EntityInvalidateChecksum(this);
 }
 
 void Guest::GiveItem(ShopItem item)
 {
     ItemFlags |= EnumToFlag(item);
+    EntityInvalidateChecksum(this);
 }
 
 bool Guest::HasItem(ShopItem peepItem) const
@@ -7559,6 +7572,7 @@ static bool IsThoughtShopItemRelated(const PeepThoughtType type)
 
 void Guest::RemoveRideFromMemory(RideId rideId)
 {
+    EntityInvalidateChecksum(this);
     if (State == PeepState::Watching)
     {
         if (CurrentRide == rideId)
@@ -148,6 +148,7 @@ void Peep::SetNextFlags(uint8_t next_direction, bool is_sloped, bool is_surface)
     NextFlags = next_direction & PEEP_NEXT_FLAG_DIRECTION_MASK;
     NextFlags |= is_sloped ? PEEP_NEXT_FLAG_IS_SLOPED : 0;
     NextFlags |= is_surface ? PEEP_NEXT_FLAG_IS_SURFACE : 0;
+    EntityInvalidateChecksum(this);
 }
 
 bool Peep::CanBePickedUp() const
@@ -887,6 +888,7 @@ void Peep::Update1()
 
 void Peep::SetState(PeepState new_state)
 {
+    EntityInvalidateChecksum(this);
     PeepDecrementNumRiders(this);
     State = new_state;
     PeepWindowStateUpdate(this);
@@ -998,6 +1000,9 @@ void Peep::Update()
         PeepFlags &= ~PEEP_FLAGS_ANIMATION_FROZEN;
     }
 
+    // Every peep that is not frozen takes steps each tick
+    EntityInvalidateChecksum(this);
+
     auto* guest = As<Guest>();
     if (guest != nullptr)
     {
@@ -1374,6 +1379,8 @@ void PeepApplause()
         if (peep->OutsideOfPark)
             continue;
 
+        EntityInvalidateChecksum(peep);
+
         // Release balloon
         GuestReleaseBalloon(peep, peep->z + 9);
 
@@ -1404,6 +1411,7 @@ void PeepUpdateDaysInQueue()
             if (peep->DaysInQueue < 255)
             {
                 peep->DaysInQueue += 1;
+                EntityInvalidateChecksum(peep);
             }
         }
     }
@@ -2759,12 +2767,14 @@ void Peep::SetDestination(const CoordsXY& coords)
 {
     DestinationX = static_cast<uint16_t>(coords.x);
     DestinationY = static_cast<uint16_t>(coords.y);
+    EntityInvalidateChecksum(this);
 }
 
 void Peep::SetDestination(const CoordsXY& coords, int32_t tolerance)
 {
     SetDestination(coords);
     DestinationTolerance = tolerance;
+    EntityInvalidateChecksum(this);
 }
 
 CoordsXY Peep::GetDestination() const
@@ -272,6 +272,7 @@ void Staff::ResetStats()
         peep->StaffLitterSwept = 0;
         peep->StaffVandalsStopped = 0;
         peep->StaffBinsEmptied = 0;
+        EntityInvalidateChecksum(peep);
     }
 }
 
@@ -897,11 +898,13 @@ void Staff::EntertainerUpdateNearbyPeeps() const
         if (guest->State == PeepState::Walking)
         {
             guest->HappinessTarget = std::min(guest->HappinessTarget + 4, kPeepMaxHappiness);
+            EntityInvalidateChecksum(guest);
         }
         else if (guest->State == PeepState::Queuing)
         {
             guest->TimeInQueue = std::max(0, guest->TimeInQueue - 200);
             guest->HappinessTarget = std::min(guest->HappinessTarget + 3, kPeepMaxHappiness);
+            EntityInvalidateChecksum(guest);
         }
     }
 }
@@ -1698,6 +1701,7 @@ void Staff::Tick128UpdateStaff()
     if (SpriteType == newSpriteType)
         return;
 
+    EntityInvalidateChecksum(this);
     SpriteType = newSpriteType;
     ActionSpriteImageOffset = 0;
     WalkingFrameNum = 0;
@@ -34,7 +34,9 @@
 #include "../core/String.hpp"
 #include "../drawing/Drawing.h"
 #include "../drawing/Font.h"
+#include "../drawing/IDrawingEngine.h"
 #include "../drawing/Image.h"
+#include "../drawing/NewDrawing.h"
 #include "../entity/Balloon.h"
 #include "../entity/EntityList.h"
 #include "../entity/EntityRegistry.h"
@@ -47,6 +49,7 @@
 #include "../management/NewsItem.h"
 #include "../management/Research.h"
 #include "../network/network.h"
+#include "../object/ImageDataPool.h"
 #include "../object/Object.h"
 #include "../object/ObjectList.h"
 #include "../object/ObjectManager.h"
@@ -64,6 +67,7 @@
 #include "Viewport.h"
 
 #include <array>
+#include <cinttypes>
 #include <cmath>
 #include <cstdarg>
 #include <cstdlib>
@@ -1329,6 +1333,38 @@ static int32_t ConsoleCommandCountObjects(InteractiveConsole& console, [[maybe_u
     return 0;
 }
 
+static int32_t ConsoleCommandObjectImages(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    const auto stats = ImageDataPool::GetStats();
+    console.WriteFormatLine(
+        "Images: %zu, unique: %zu (%zu duplicates)", stats.ReferencedImages, stats.UniqueImages,
+        stats.ReferencedImages - stats.UniqueImages);
+    console.WriteFormatLine(
+        "Image data: %.1f KiB, unique: %.1f KiB (%.1f KiB saved)", stats.ReferencedBytes / 1024.0,
+        stats.UniqueBytes / 1024.0, stats.GetSavedBytes() / 1024.0);
+    return 0;
+}
+
+static int32_t ConsoleCommandRepaintStats(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    const auto stats = DrawingEngineGetRepaintStats();
+    if (stats.ScreenPixels == 0 || stats.Frames == 0)
+    {
+        console.WriteLineError("The drawing engine does not track repainted regions.");
+        return 1;
+    }
+
+    console.WriteFormatLine(
+        "Last frame: %" PRIu64 " pixels (%.1f%% of the screen) in %u regions%s", stats.Pixels,
+        stats.Pixels * 100.0 / stats.ScreenPixels, stats.Rects, stats.FullRedraw ? ", full redraw" : "");
+    console.WriteFormatLine(
+        "Average: %.0f pixels per frame (%.1f%% of the screen), %" PRIu64 " of %" PRIu64 " frames were full redraws",
+        static_cast<double>(stats.TotalPixels) / stats.Frames,
+        static_cast<double>(stats.TotalPixels) * 100.0 / (stats.ScreenPixels * stats.Frames), stats.FullRedraws,
+        stats.Frames);
+    return 0;
+}
+
 static int32_t ConsoleCommandOpen(InteractiveConsole& console, const arguments_t& argv)
 {
     if (!argv.empty())
@@ -1697,6 +1733,33 @@ static int32_t ConsoleCommandReplayStop(InteractiveConsole& console, const argum
     return 0;
 }
 
+static int32_t ConsoleCommandReplaySeek(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (NetworkGetMode() != NETWORK_MODE_NONE)
+    {
+        console.WriteFormatLine("This command is currently not supported in multiplayer mode.");
+        return 0;
+    }
+
+    if (argv.size() < 1)
+    {
+        console.WriteFormatLine("Parameters required <tick>");
+        return 0;
+    }
+
+    uint32_t tick = atol(argv[0].c_str());
+
+    auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
+    if (replayManager->SeekToTick(tick))
+    {
+        console.WriteFormatLine("Replay now at tick %u", tick);
+        return 1;
+    }
+
+    console.WriteFormatLine("Unable to seek to tick %u", tick);
+    return 0;
+}
+
 static int32_t ConsoleCommandReplayNormalise(InteractiveConsole& console, const arguments_t& argv)
 {
     if (NetworkGetMode() != NETWORK_MODE_NONE)
@@ -2016,11 +2079,15 @@ static constexpr ConsoleCommand console_command_table[] = {
       "load_object <objectfilenodat>" },
     { "load_park", ConsoleCommandLoadPark, "Load park from save directory or by absolute path", "load_park <filename>" },
     { "object_count", ConsoleCommandCountObjects, "Shows the number of objects of each type in the scenario.", "object_count" },
+    { "object_images", ConsoleCommandObjectImages, "Shows how much memory sharing identical object images saves.",
+      "object_images" },
     { "open", ConsoleCommandOpen, "Opens the window with the give name.", "open <window>." },
     { "quit", ConsoleCommandClose, "Closes the console.", "quit" },
     { "remove_unused_objects", ConsoleCommandRemoveUnusedObjects, "Removes all the unused objects from the object selection.",
       "remove_unused_objects" },
     { "remove_floating_objects", ConsoleCommandRemoveFloatingObjects, "Removes floating objects", "remove_floating_objects" },
+    { "repaint_stats", ConsoleCommandRepaintStats, "Shows how much of the screen is painted again each frame.",
+      "repaint_stats" },
     { "rides", ConsoleCommandRides, "Ride management.", "rides <subcommand>" },
     { "save_park", ConsoleCommandSavePark, "Save current state of park. If no name specified default path will be used.",
       "save_park [name]" },
@@ -2038,6 +2105,7 @@ static constexpr ConsoleCommand console_command_table[] = {
     { "replay_stoprecord", ConsoleCommandReplayStopRecord, "Stops recording a new replay.", "replay_stoprecord" },
     { "replay_start", ConsoleCommandReplayStart, "Starts a replay", "replay_start <name>" },
     { "replay_stop", ConsoleCommandReplayStop, "Stops the replay", "replay_stop" },
+    { "replay_seek", ConsoleCommandReplaySeek, "Jumps the replay to the given tick", "replay_seek <tick>" },
     { "replay_normalise", ConsoleCommandReplayNormalise, "Normalises the replay to remove all gaps",
       "replay_normalise <input file> <output file>" },
     { "mp_desync", ConsoleCommandMpDesync, "Forces a multiplayer desync",
@@ -15,12 +15,14 @@
 #include "../GameState.h"
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
+#include "../Version.h"
 #include "../actions/CheatSetAction.h"
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Console.hpp"
 #include "../core/File.h"
 #include "../core/Imaging.h"
+#include "../core/Json.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../drawing/Drawing.h"
@@ -41,6 +43,8 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace std::literals::string_literals;
 using namespace OpenRCT2;
@@ -562,6 +566,220 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
     return exitCode;
 }
 
+struct BenchPaintCamera
+{
+    const char* Name;
+    // Position as a fraction of the map size, in quarters
+    int32_t X;
+    int32_t Y;
+};
+
+static constexpr BenchPaintCamera kBenchPaintCameras[] = {
+    { "centre", 2, 2 },
+    { "quarter", 1, 1 },
+    { "three-quarters", 3, 3 },
+};
+
+struct BenchPaintPhase
+{
+    const char* Name;
+    std::chrono::steady_clock::duration ViewportPaintColumnTimings::*Time;
+};
+
+static constexpr BenchPaintPhase kBenchPaintPhases[] = {
+    { "generate", &ViewportPaintColumnTimings::Generate },
+    { "arrange", &ViewportPaintColumnTimings::Arrange },
+    { "draw", &ViewportPaintColumnTimings::Draw },
+};
+
+static double ToMilliseconds(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+static Viewport GetBenchPaintViewport(
+    const BenchPaintOptions& options, const BenchPaintCamera& camera, ZoomLevel zoom, uint8_t rotation)
+{
+    const auto& mapSize = GetGameState().MapSize;
+    auto x = (mapSize.x * camera.X / 4) * kCoordsXYStep + kCoordsXYHalfTile;
+    auto y = (mapSize.y * camera.Y / 4) * kCoordsXYStep + kCoordsXYHalfTile;
+    auto coords2d = Translate3DTo2DWithZ(rotation, { x, y, TileElementHeight({ x, y }) });
+
+    Viewport viewport{};
+    viewport.width = options.width;
+    viewport.height = options.height;
+    viewport.view_width = zoom.ApplyTo(options.width);
+    viewport.view_height = zoom.ApplyTo(options.height);
+    viewport.viewPos = { coords2d.x - viewport.view_width / 2, coords2d.y - viewport.view_height / 2 };
+    viewport.zoom = zoom;
+    viewport.rotation = rotation;
+    return viewport;
+}
+
+/**
+ * Paints one camera position the given number of times and adds the results in the Google benchmark JSON format,
+ * one benchmark per phase with the mean time of each column, and one for the whole paint.
+ */
+static void BenchPaintCase(
+    const BenchPaintOptions& options, IDrawingEngine& drawingEngine, const std::string& name, const Viewport& viewport,
+    json_t& benchmarks)
+{
+    std::vector<uint8_t> bits(static_cast<size_t>(viewport.width) * viewport.height);
+    DrawPixelInfo dpi;
+    dpi.bits = bits.data();
+    dpi.width = viewport.width;
+    dpi.height = viewport.height;
+    dpi.DrawingEngine = &drawingEngine;
+
+    const ScreenRect screenRect = { { 0, 0 }, { viewport.width, viewport.height } };
+    std::vector<ViewportPaintColumnTimings> timings;
+    std::vector<ViewportPaintColumnTimings> totalTimings;
+    std::chrono::steady_clock::duration totalTime{};
+
+    // Warm up caches and image loading before measuring
+    ResetAllSpriteQuadrantPlacements();
+    ViewportRender(dpi, &viewport, screenRect);
+
+    for (int32_t i = 0; i < options.iterations; i++)
+    {
+        ResetAllSpriteQuadrantPlacements();
+        const auto start = std::chrono::steady_clock::now();
+        ViewportRender(dpi, &viewport, screenRect, &timings);
+        totalTime += std::chrono::steady_clock::now() - start;
+
+        totalTimings.resize(std::max(totalTimings.size(), timings.size()));
+        for (size_t column = 0; column < timings.size(); column++)
+        {
+            totalTimings[column].Generate += timings[column].Generate;
+            totalTimings[column].Arrange += timings[column].Arrange;
+            totalTimings[column].Draw += timings[column].Draw;
+        }
+    }
+
+    auto addBenchmark = [&](const std::string& benchmarkName, double time, json_t columns) {
+        json_t benchmark = {
+            { "name", benchmarkName },
+            { "run_name", benchmarkName },
+            { "run_type", "iteration" },
+            { "iterations", options.iterations },
+            { "real_time", time },
+            { "cpu_time", time },
+            { "time_unit", "ms" },
+        };
+        if (!columns.is_null())
+        {
+            benchmark["columns"] = std::move(columns);
+        }
+        benchmarks.push_back(std::move(benchmark));
+    };
+
+    double phaseTimes[std::size(kBenchPaintPhases)]{};
+    for (size_t phase = 0; phase < std::size(kBenchPaintPhases); phase++)
+    {
+        auto columns = json_t::array();
+        for (const auto& column : totalTimings)
+        {
+            const auto time = ToMilliseconds(column.*kBenchPaintPhases[phase].Time) / options.iterations;
+            columns.push_back(time);
+            phaseTimes[phase] += time;
+        }
+        addBenchmark(name + "/" + kBenchPaintPhases[phase].Name, phaseTimes[phase], std::move(columns));
+    }
+    const auto total = ToMilliseconds(totalTime) / options.iterations;
+    addBenchmark(name + "/total", total, nullptr);
+
+    Console::WriteLine(
+        "%-48s %9.3f %9.3f %9.3f %9.3f", name.c_str(), phaseTimes[0], phaseTimes[1], phaseTimes[2], total);
+}
+
+int32_t CommandLineForBenchPaint(const char** argv, int32_t argc, const BenchPaintOptions* options)
+{
+    // Don't include options in the count (they have been handled by CommandLine::ParseOptions already)
+    for (int32_t i = 0; i < argc; i++)
+    {
+        if (argv[i][0] == '-')
+        {
+            argc = i;
+            break;
+        }
+    }
+
+    if (argc < 1 || options->iterations < 1 || options->width < 1 || options->height < 1)
+    {
+        std::printf(
+            "Usage: openrct2 bench-paint <file> [<file>...] [--iterations=<n>] [--width=<n>] [--height=<n>] "
+            "[--output=<json file>]\n");
+        return -1;
+    }
+
+    int32_t exitCode = 1;
+    try
+    {
+        gOpenRCT2Headless = true;
+        auto context = CreateContext();
+        if (!context->Initialise())
+        {
+            throw std::runtime_error("Failed to initialize context.");
+        }
+
+        DrawingEngineInit();
+        auto drawingEngine = std::make_unique<X8DrawingEngine>(GetContext()->GetUiContext());
+
+        auto benchmarks = json_t::array();
+        Console::WriteLine(
+            "%-48s %9s %9s %9s %9s", "Benchmark (mean ms per paint)", "Generate", "Arrange", "Draw", "Total");
+        for (int32_t i = 0; i < argc; i++)
+        {
+            const char* inputPath = argv[i];
+            if (!context->LoadParkFromFile(inputPath))
+            {
+                throw std::runtime_error(std::string("Failed to load park: ") + inputPath);
+            }
+            gScreenFlags = SCREEN_FLAGS_PLAYING;
+
+            const auto parkName = Path::GetFileName(inputPath);
+            for (const auto& camera : kBenchPaintCameras)
+            {
+                for (auto zoom = ZoomLevel{ 0 }; zoom <= ZoomLevel::max(); zoom++)
+                {
+                    for (uint8_t rotation = 0; rotation < 4; rotation++)
+                    {
+                        const auto name = parkName + "/" + camera.Name + "/zoom:" + std::to_string(static_cast<int8_t>(zoom))
+                            + "/rotation:" + std::to_string(rotation);
+                        const auto viewport = GetBenchPaintViewport(*options, camera, zoom, rotation);
+                        BenchPaintCase(*options, *drawingEngine, name, viewport, benchmarks);
+                    }
+                }
+            }
+        }
+
+        if (!options->output.empty())
+        {
+            json_t benchContext = {
+                { "executable", "openrct2 bench-paint" },
+                { "version", std::string(gVersionInfoFull) },
+                { "num_cpus", std::thread::hardware_concurrency() },
+                { "multithreading", Config::Get().general.MultiThreading != 0 },
+                { "width", options->width },
+                { "height", options->height },
+            };
+            json_t root = { { "context", std::move(benchContext) }, { "benchmarks", std::move(benchmarks) } };
+            Json::WriteToFile(options->output, root);
+            Console::WriteLine("Results written to %s", options->output.c_str());
+        }
+        exitCode = 0;
+    }
+    catch (const std::exception& e)
+    {
+        std::printf("%s\n", e.what());
+        exitCode = -1;
+    }
+
+    DrawingEngineDispose();
+
+    return exitCode;
+}
+
 static bool IsPathChildOf(fs::path x, const fs::path& parent)
 {
     auto xp = x.parent_path();
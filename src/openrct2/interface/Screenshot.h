@@ -35,6 +35,14 @@ struct ScreenshotOptions
     bool transparent = false;
 };
 
+struct BenchPaintOptions
+{
+    int32_t iterations = 10;
+    int32_t width = 1920;
+    int32_t height = 1080;
+    std::string output;
+};
+
 struct CaptureView
 {
     int32_t Width{};
@@ -57,5 +65,6 @@ std::string ScreenshotDumpPNG(DrawPixelInfo& dpi);
 
 void ScreenshotGiant();
 int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOptions* options);
+int32_t CommandLineForBenchPaint(const char** argv, int32_t argc, const BenchPaintOptions* options);
 
 void CaptureImage(const CaptureOptions& options);
@@ -17,7 +17,7 @@
 #include "../OpenRCT2.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
-#include "../core/JobPool.h"
+#include "../core/JobScheduler.h"
 #include "../drawing/Drawing.h"
 #include "../drawing/IDrawingEngine.h"
 #include "../entity/EntityList.h"
@@ -28,6 +28,7 @@
 #include "../object/SmallSceneryEntry.h"
 #include "../object/WallSceneryEntry.h"
 #include "../paint/Paint.h"
+#include "../paint/Paint.TileCache.h"
 #include "../profiling/Profiling.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
@@ -39,12 +40,15 @@
 #include "../world/Climate.h"
 #include "../world/Map.h"
 #include "Colour.h"
+#include "ViewportInteractionBuffer.h"
 #include "Window.h"
 #include "Window_internal.h"
 
+#include <algorithm>
 #include <cstring>
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -62,8 +66,38 @@ uint8_t gShowConstructionRightsRefCount;
 static std::list<Viewport> _viewports;
 Viewport* g_music_tracking_viewport;
 
-static std::unique_ptr<JobPool> _paintJobs;
-static std::vector<PaintSession*> _paintColumns;
+/**
+ * A 32 pixel wide column of the viewport, or a horizontal band of one when the column is expensive to paint.
+ */
+struct ViewportPaintPart
+{
+    PaintSession* Session;
+    size_t Column;
+    std::chrono::steady_clock::duration EstimatedCost;
+    ViewportPaintColumnTimings Timings;
+};
+
+static std::vector<ViewportPaintPart> _paintParts;
+
+// Runs of consecutive parts that are painted by the same task, as [begin, end) indices into _paintParts
+static std::vector<std::pair<size_t, size_t>> _paintBatches;
+
+// Time it took to paint a row of a column the last time it was visible, by viewport, then by zoom level, rotation and
+// position. Dirty rects repaint columns at any height, so the time is kept per row painted.
+using PaintColumnCostPerRow = std::chrono::duration<float, std::nano>;
+static std::unordered_map<const Viewport*, std::unordered_map<uint64_t, PaintColumnCostPerRow>> _paintColumnCosts;
+static std::vector<std::chrono::steady_clock::duration> _paintColumnEstimates;
+static constexpr size_t kMaxPaintColumnCosts = 1 << 14;
+
+// More tasks than threads, so that wrong estimates are evened out by the threads that finish early
+static constexpr size_t kPaintTasksPerThread = 4;
+static constexpr int32_t kMaxPaintPartsPerColumn = 8;
+static constexpr int32_t kMinPaintPartHeight = 64;
+
+// Viewports get an interaction buffer once they are queried, it is dropped when they have not been for a while
+static std::unordered_map<const Viewport*, std::unique_ptr<ViewportInteractionBuffer>> _interactionBuffers;
+static ViewportInteractionBuffer* _paintInteractionBuffer;
+static constexpr auto kInteractionBufferTimeout = std::chrono::seconds(10);
 
 InteractionInfo::InteractionInfo(const PaintStruct* ps)
     : Loc(ps->MapPos)
@@ -74,7 +108,10 @@ InteractionInfo::InteractionInfo(const PaintStruct* ps)
 }
 
 static void ViewportPaintWeatherGloom(DrawPixelInfo& dpi);
-static void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRect& screenRect);
+static void ViewportWriteInteractionBuffer(const PaintSession& session, ViewportInteractionBuffer& buffer);
+static void ViewportPaint(
+    const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRect& screenRect,
+    std::vector<ViewportPaintColumnTimings>* timings);
 static void ViewportUpdateFollowSprite(WindowBase* window);
 static void ViewportUpdateSmartFollowEntity(WindowBase* window);
 static void ViewportUpdateSmartFollowStaff(WindowBase* window, const Staff& peep);
@@ -229,6 +266,8 @@ void ViewportRemove(Viewport* viewport)
         LOG_ERROR("Unable to remove viewport: %p", viewport);
         return;
     }
+    _interactionBuffers.erase(viewport);
+    _paintColumnCosts.erase(viewport);
     _viewports.erase(it);
 }
 
@@ -325,6 +364,93 @@ CoordsXYZ ViewportAdjustForMapHeight(const ScreenCoordsXY& startCoords, uint8_t
     return { pos, height };
 }
 
+// Regions uncovered by scrolling viewports, painted once all viewports have been shifted
+static std::vector<ScreenRect> _shiftRedrawRects;
+
+static void ViewportQueueShiftRedraw(int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    if (left < right && top < bottom)
+    {
+        _shiftRedrawRects.emplace_back(left, top, right, bottom);
+    }
+}
+
+static bool AreRectsIntersecting(const ScreenRect& a, const ScreenRect& b)
+{
+    return a.GetLeft() < b.GetRight() && b.GetLeft() < a.GetRight() && a.GetTop() < b.GetBottom()
+        && b.GetTop() < a.GetBottom();
+}
+
+/**
+ * Joins the queued regions that share a whole edge, the strips of a viewport that is split up by the windows in front
+ * of it are painted as one.
+ */
+static void ViewportMergeShiftRedraws()
+{
+    for (size_t i = 0; i < _shiftRedrawRects.size(); i++)
+    {
+        for (size_t j = i + 1; j < _shiftRedrawRects.size();)
+        {
+            auto& a = _shiftRedrawRects[i];
+            const auto& b = _shiftRedrawRects[j];
+            const bool sameColumns = a.GetLeft() == b.GetLeft() && a.GetRight() == b.GetRight();
+            const bool sameRows = a.GetTop() == b.GetTop() && a.GetBottom() == b.GetBottom();
+            if ((sameColumns && (a.GetBottom() == b.GetTop() || b.GetBottom() == a.GetTop()))
+                || (sameRows && (a.GetRight() == b.GetLeft() || b.GetRight() == a.GetLeft())))
+            {
+                a = ScreenRect(
+                    std::min(a.GetLeft(), b.GetLeft()), std::min(a.GetTop(), b.GetTop()),
+                    std::max(a.GetRight(), b.GetRight()), std::max(a.GetBottom(), b.GetBottom()));
+                _shiftRedrawRects.erase(_shiftRedrawRects.begin() + j);
+
+                // The grown region may now join one that was checked before
+                j = i + 1;
+            }
+            else
+            {
+                j++;
+            }
+        }
+    }
+}
+
+/**
+ * Returns whether painting a region can be left to the dirty blocks that the drawing engine paints later in the frame.
+ * Not when another viewport overlaps it, as that viewport could copy the unpainted pixels when it scrolls.
+ */
+static bool CanSkipShiftRedraw(const ScreenRect& rect, const Viewport* viewport)
+{
+    if (!DrawingEngineIsInvalidated(rect.GetLeft(), rect.GetTop(), rect.GetRight(), rect.GetBottom()))
+        return false;
+
+    for (const auto& other : _viewports)
+    {
+        if (&other == viewport)
+            continue;
+
+        const auto otherRect = ScreenRect(other.pos, other.pos + ScreenCoordsXY{ other.width, other.height });
+        if (AreRectsIntersecting(rect, otherRect))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Paints the queued regions, skipping the ones that will be painted later in the frame when a viewport is given.
+ */
+static void ViewportFlushShiftRedraws(DrawPixelInfo& dpi, const Viewport* viewport)
+{
+    ViewportMergeShiftRedraws();
+    for (const auto& rect : _shiftRedrawRects)
+    {
+        if (viewport != nullptr && CanSkipShiftRedraw(rect, viewport))
+            continue;
+
+        WindowDrawAll(dpi, rect.GetLeft(), rect.GetTop(), rect.GetRight(), rect.GetBottom());
+    }
+    _shiftRedrawRects.clear();
+}
+
 /*
  *  rct2: 0x006E7FF3
  */
@@ -411,6 +537,16 @@ static void ViewportRedrawAfterShift(DrawPixelInfo& dpi, WindowBase* window, Vie
         // if moved more than the viewport size
         if (abs(coords.x) < viewport->width && abs(coords.y) < viewport->height)
         {
+            // The pixels that are copied have to be painted already
+            const auto source = ScreenRect(
+                left - coords.x, top - coords.y, right - coords.x, bottom - coords.y);
+            if (std::any_of(_shiftRedrawRects.begin(), _shiftRedrawRects.end(), [&source](const ScreenRect& rect) {
+                    return AreRectsIntersecting(rect, source);
+                }))
+            {
+                ViewportFlushShiftRedraws(dpi, nullptr);
+            }
+
             // update whole block ?
             DrawingEngineCopyRect(viewport->pos.x, viewport->pos.y, viewport->width, viewport->height, coords.x, coords.y);
 
@@ -418,14 +554,14 @@ static void ViewportRedrawAfterShift(DrawPixelInfo& dpi, WindowBase* window, Vie
             {
                 // draw left
                 auto _right = viewport->pos.x + coords.x;
-                WindowDrawAll(dpi, left, top, _right, bottom);
+                ViewportQueueShiftRedraw(left, top, _right, bottom);
                 left += coords.x;
             }
             else if (coords.x < 0)
             {
                 // draw right
                 auto _left = viewport->pos.x + viewport->width + coords.x;
-                WindowDrawAll(dpi, _left, top, right, bottom);
+                ViewportQueueShiftRedraw(_left, top, right, bottom);
                 right += coords.x;
             }
 
@@ -433,19 +569,19 @@ static void ViewportRedrawAfterShift(DrawPixelInfo& dpi, WindowBase* window, Vie
             {
                 // draw top
                 bottom = viewport->pos.y + coords.y;
-                WindowDrawAll(dpi, left, top, right, bottom);
+                ViewportQueueShiftRedraw(left, top, right, bottom);
             }
             else if (coords.y < 0)
             {
                 // draw bottom
                 top = viewport->pos.y + viewport->height + coords.y;
-                WindowDrawAll(dpi, left, top, right, bottom);
+                ViewportQueueShiftRedraw(left, top, right, bottom);
             }
         }
         else
         {
             // redraw whole viewport
-            WindowDrawAll(dpi, left, top, right, bottom);
+            ViewportQueueShiftRedraw(left, top, right, bottom);
         }
     }
 }
@@ -495,6 +631,7 @@ static void ViewportShiftPixels(DrawPixelInfo& dpi, WindowBase* window, Viewport
     }
 
     ViewportRedrawAfterShift(dpi, window, viewport, { x_diff, y_diff });
+    ViewportFlushShiftRedraws(dpi, viewport);
 }
 
 static void ViewportMove(const ScreenCoordsXY& coords, WindowBase* w, Viewport* viewport)
@@ -925,7 +1062,9 @@ void ViewportRotateAll(int32_t direction)
  *  edi: dpi
  *  ebp: bottom
  */
-void ViewportRender(DrawPixelInfo& dpi, const Viewport* viewport, const ScreenRect& screenRect)
+void ViewportRender(
+    DrawPixelInfo& dpi, const Viewport* viewport, const ScreenRect& screenRect,
+    std::vector<ViewportPaintColumnTimings>* timings)
 {
     if (viewport->flags & VIEWPORT_FLAG_RENDERING_INHIBITED)
         return;
@@ -958,7 +1097,7 @@ void ViewportRender(DrawPixelInfo& dpi, const Viewport* viewport, const ScreenRe
         viewport->zoom.ApplyTo(std::min(bottomRight.y, viewport->height)),
     } + viewport->viewPos;
 
-    ViewportPaint(viewport, dpi, { topLeft, bottomRight });
+    ViewportPaint(viewport, dpi, { topLeft, bottomRight }, timings);
 
 #ifdef DEBUG_SHOW_DIRTY_BOX
     // FIXME g_viewport_list doesn't exist anymore
@@ -967,15 +1106,29 @@ void ViewportRender(DrawPixelInfo& dpi, const Viewport* viewport, const ScreenRe
 #endif
 }
 
-static void ViewportFillColumn(PaintSession& session)
+/**
+ * @param timings If set, receives the time spent, the clock is not read otherwise.
+ */
+static void ViewportFillColumn(PaintSession& session, ViewportPaintColumnTimings* timings)
 {
     PROFILED_FUNCTION();
 
+    if (timings == nullptr)
+    {
+        PaintSessionGenerate(session);
+        PaintSessionArrange(session);
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
     PaintSessionGenerate(session);
+    const auto generated = std::chrono::steady_clock::now();
     PaintSessionArrange(session);
+    timings->Generate = generated - start;
+    timings->Arrange = std::chrono::steady_clock::now() - generated;
 }
 
-static void ViewportPaintColumn(PaintSession& session)
+static void ViewportDrawColumn(PaintSession& session)
 {
     PROFILED_FUNCTION();
 
@@ -1006,6 +1159,81 @@ static void ViewportPaintColumn(PaintSession& session)
     }
 }
 
+static void ViewportPaintColumn(PaintSession& session, ViewportPaintColumnTimings* timings)
+{
+    if (timings == nullptr)
+    {
+        ViewportDrawColumn(session);
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    ViewportDrawColumn(session);
+    timings->Draw = std::chrono::steady_clock::now() - start;
+}
+
+static void ViewportFillBatch(size_t begin, size_t end, bool measure)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        ViewportFillColumn(*_paintParts[i].Session, measure ? &_paintParts[i].Timings : nullptr);
+        if (_paintInteractionBuffer != nullptr)
+        {
+            ViewportWriteInteractionBuffer(*_paintParts[i].Session, *_paintInteractionBuffer);
+        }
+    }
+}
+
+static void ViewportPaintBatch(size_t begin, size_t end, bool measure)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        ViewportPaintColumn(*_paintParts[i].Session, measure ? &_paintParts[i].Timings : nullptr);
+    }
+}
+
+static uint64_t GetPaintColumnCostKey(const Viewport& viewport, int32_t x)
+{
+    return (static_cast<uint64_t>(static_cast<uint8_t>(static_cast<int8_t>(viewport.zoom))) << 40)
+        | (static_cast<uint64_t>(viewport.rotation) << 32) | static_cast<uint32_t>(x);
+}
+
+/**
+ * Estimates the cost of painting each column at the given height from the last frame it was painted in. Columns
+ * that have not been painted before are assumed to cost the average of the known ones. Returns the total cost.
+ */
+static std::chrono::steady_clock::duration ViewportEstimateColumnCosts(
+    const Viewport& viewport, int32_t alignedX, size_t numColumns, int32_t height)
+{
+    using Duration = std::chrono::steady_clock::duration;
+
+    const auto& costs = _paintColumnCosts[&viewport];
+    _paintColumnEstimates.assign(numColumns, Duration::zero());
+    Duration total = Duration::zero();
+    size_t numKnown = 0;
+    for (size_t i = 0; i < numColumns; i++)
+    {
+        auto it = costs.find(GetPaintColumnCostKey(viewport, alignedX + static_cast<int32_t>(i) * 32));
+        if (it != costs.end())
+        {
+            _paintColumnEstimates[i] = std::max(std::chrono::duration_cast<Duration>(it->second * height), Duration{ 1 });
+            total += _paintColumnEstimates[i];
+            numKnown++;
+        }
+    }
+
+    const auto unknownCost = numKnown != 0 ? total / static_cast<int64_t>(numKnown) : Duration{ 1 };
+    for (auto& estimate : _paintColumnEstimates)
+    {
+        if (estimate == Duration::zero())
+        {
+            estimate = unknownCost;
+            total += unknownCost;
+        }
+    }
+    return total;
+}
+
 /**
  *
  *  rct2: 0x00685CBF
@@ -1016,7 +1244,9 @@ static void ViewportPaintColumn(PaintSession& session)
  *  edi: dpi
  *  ebp: bottom
  */
-static void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRect& screenRect)
+static void ViewportPaint(
+    const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRect& screenRect,
+    std::vector<ViewportPaintColumnTimings>* timings)
 {
     PROFILED_FUNCTION();
 
@@ -1059,31 +1289,53 @@ static void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const Sc
     auto rightBorder = dpi1.x + dpi1.width;
     auto alignedX = Floor2(dpi1.x, 32);
 
-    _paintColumns.clear();
+    const size_t numColumns = rightBorder > alignedX ? (rightBorder - alignedX + 31) / 32 : 0;
 
-    bool useMultithreading = Config::Get().general.MultiThreading;
-    if (useMultithreading && _paintJobs == nullptr)
-    {
-        _paintJobs = std::make_unique<JobPool>();
-    }
-    else if (useMultithreading == false && _paintJobs != nullptr)
+    _paintInteractionBuffer = nullptr;
+    if (auto it = _interactionBuffers.find(viewport); it != _interactionBuffers.end())
     {
-        _paintJobs.reset();
+        if (!Config::Get().general.InteractionBuffer
+            || std::chrono::steady_clock::now() - it->second->GetLastQuery() > kInteractionBufferTimeout)
+        {
+            _interactionBuffers.erase(it);
+        }
+        else
+        {
+            _paintInteractionBuffer = it->second.get();
+            _paintInteractionBuffer->Prepare(*viewport);
+        }
     }
 
+    PaintTileCacheUpdate();
+
+    bool useMultithreading = Config::Get().general.MultiThreading;
+    TaskGroup paintTasks;
+
     bool useParallelDrawing = false;
     if (useMultithreading && (dpi.DrawingEngine->GetFlags() & DEF_PARALLEL_DRAWING))
     {
         useParallelDrawing = true;
     }
 
-    // Generate and sort columns.
-    for (x = alignedX; x < rightBorder; x += 32)
+    // Without adaptive partitioning every column is a task of its own, whatever it costs.
+    const bool useAdaptivePartitioning = useMultithreading && Config::Get().general.AdaptivePaintColumns;
+    const bool measureParts = useAdaptivePartitioning || timings != nullptr;
+    auto targetCost = std::chrono::steady_clock::duration::max();
+    if (useAdaptivePartitioning)
     {
-        PaintSession* session = PaintSessionAlloc(dpi1, viewFlags, viewport->rotation);
-        _paintColumns.push_back(session);
+        const auto totalCost = ViewportEstimateColumnCosts(*viewport, alignedX, numColumns, dpi1.height);
+        const auto numThreads = std::max<size_t>(1, JobScheduler::Get().GetThreadCount());
+        const auto numTasks = static_cast<int64_t>(numThreads * kPaintTasksPerThread);
+        targetCost = std::max(totalCost / numTasks, std::chrono::steady_clock::duration{ 1 });
+    }
 
-        DrawPixelInfo& dpi2 = session->DPI;
+    // Split columns into parts.
+    _paintParts.clear();
+    for (size_t column = 0; column < numColumns; column++)
+    {
+        x = alignedX + static_cast<int32_t>(column) * 32;
+
+        DrawPixelInfo dpi2 = dpi1;
         if (x >= dpi2.x)
         {
             auto leftPitch = x - dpi2.x;
@@ -1102,42 +1354,131 @@ static void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const Sc
         }
         dpi2.width = paintRight - dpi2.x;
 
+        // Expensive columns are split into bands, a column has to stay 32 wide for the tile iteration.
+        int32_t numParts = 1;
+        auto estimatedCost = std::chrono::steady_clock::duration::zero();
+        if (useAdaptivePartitioning)
+        {
+            estimatedCost = _paintColumnEstimates[column];
+            const auto wantedParts = (estimatedCost + targetCost - std::chrono::steady_clock::duration{ 1 }) / targetCost;
+            numParts = static_cast<int32_t>(std::min<int64_t>(wantedParts, kMaxPaintPartsPerColumn));
+            numParts = std::max(1, std::min(numParts, dpi2.height / kMinPaintPartHeight));
+        }
+
+        // Bands are a multiple of 32 high so that they start on a whole pixel at every zoom level.
+        const int32_t partHeight = numParts > 1 ? Ceil2((dpi2.height + numParts - 1) / numParts, 32) : dpi2.height;
+        for (int32_t part = 0; part < numParts; part++)
+        {
+            const int32_t top = part * partHeight;
+            if (part != 0 && top >= dpi2.height)
+                break;
+
+            DrawPixelInfo partDpi = dpi2;
+            if (top != 0)
+            {
+                partDpi.y += top;
+                partDpi.bits += partDpi.zoom_level.ApplyInversedTo(top)
+                    * (partDpi.zoom_level.ApplyInversedTo(partDpi.width) + partDpi.pitch);
+            }
+            partDpi.height = std::min(partHeight, dpi2.height - top);
+
+            PaintSession* session = PaintSessionAlloc(partDpi, viewFlags, viewport->rotation);
+            session->MayCullImages = Config::Get().general.LevelOfDetailCulling;
+            _paintParts.push_back({ session, column, estimatedCost / numParts, {} });
+        }
+    }
+
+    // Batch cheap parts together, each batch is painted by one task.
+    _paintBatches.clear();
+    auto batchCost = std::chrono::steady_clock::duration::zero();
+    size_t batchBegin = 0;
+    for (size_t i = 0; i < _paintParts.size(); i++)
+    {
+        batchCost += _paintParts[i].EstimatedCost;
+        if (!useAdaptivePartitioning || batchCost >= targetCost || i + 1 == _paintParts.size())
+        {
+            _paintBatches.emplace_back(batchBegin, i + 1);
+            batchBegin = i + 1;
+            batchCost = std::chrono::steady_clock::duration::zero();
+        }
+    }
+
+    // Generate and sort parts.
+    for (const auto& batch : _paintBatches)
+    {
+        const auto begin = batch.first;
+        const auto end = batch.second;
         if (useMultithreading)
         {
-            _paintJobs->AddTask([session]() -> void { ViewportFillColumn(*session); });
+            paintTasks.Run([begin, end, measureParts]() -> void { ViewportFillBatch(begin, end, measureParts); });
         }
         else
         {
-            ViewportFillColumn(*session);
+            ViewportFillBatch(begin, end, measureParts);
         }
     }
 
     if (useMultithreading)
     {
-        _paintJobs->Join();
+        paintTasks.Wait();
     }
 
-    // Paint columns.
-    for (auto* session : _paintColumns)
+    // Paint parts.
+    for (const auto& batch : _paintBatches)
     {
+        const auto begin = batch.first;
+        const auto end = batch.second;
         if (useParallelDrawing)
         {
-            _paintJobs->AddTask([session]() -> void { ViewportPaintColumn(*session); });
+            paintTasks.Run([begin, end, measureParts]() -> void { ViewportPaintBatch(begin, end, measureParts); });
         }
         else
         {
-            ViewportPaintColumn(*session);
+            ViewportPaintBatch(begin, end, measureParts);
         }
     }
     if (useParallelDrawing)
     {
-        _paintJobs->Join();
+        paintTasks.Wait();
+    }
+
+    if (timings != nullptr)
+    {
+        timings->assign(numColumns, {});
+        for (const auto& part : _paintParts)
+        {
+            auto& columnTimings = (*timings)[part.Column];
+            columnTimings.Generate += part.Timings.Generate;
+            columnTimings.Arrange += part.Timings.Arrange;
+            columnTimings.Draw += part.Timings.Draw;
+        }
+    }
+
+    // Remember what each column cost for partitioning the next frame.
+    if (useAdaptivePartitioning && dpi1.height > 0)
+    {
+        auto& costs = _paintColumnCosts[viewport];
+        if (costs.size() > kMaxPaintColumnCosts)
+        {
+            costs.clear();
+        }
+
+        _paintColumnEstimates.assign(numColumns, std::chrono::steady_clock::duration::zero());
+        for (const auto& part : _paintParts)
+        {
+            _paintColumnEstimates[part.Column] += part.Timings.Generate + part.Timings.Arrange + part.Timings.Draw;
+        }
+        for (size_t column = 0; column < numColumns; column++)
+        {
+            const auto key = GetPaintColumnCostKey(*viewport, alignedX + static_cast<int32_t>(column) * 32);
+            costs[key] = PaintColumnCostPerRow(_paintColumnEstimates[column]) / dpi1.height;
+        }
     }
 
     // Release resources.
-    for (auto* session : _paintColumns)
+    for (const auto& part : _paintParts)
     {
-        PaintSessionFree(session);
+        PaintSessionFree(part.Session);
     }
 }
 
@@ -1627,12 +1968,44 @@ static bool IsPixelPresentRLE(const void* data, const int32_t x, const int32_t y
 }
 
 /**
- * rct2: 0x00679074
+ * A sprite prepared for hit testing, so that it can be tested against many points.
  */
-static bool IsSpriteInteractedWithPaletteSet(
-    DrawPixelInfo& dpi, ImageId imageId, const ScreenCoordsXY& coords, const PaletteMap& paletteMap, const uint8_t imageType)
+struct InteractionSprite
 {
-    PROFILED_FUNCTION();
+    const G1Element* G1{};
+    ScreenCoordsXY Origin;
+    int32_t ZoomShift{};
+    PaletteMap Palette = PaletteMap::GetDefault();
+    uint8_t ImageType{};
+};
+
+/**
+ *
+ *  rct2: 0x00679023
+ */
+static bool PrepareInteractionSprite(ImageId imageId, const ScreenCoordsXY& coords, ZoomLevel zoom, InteractionSprite& sprite)
+{
+    if (imageId.HasPrimary() || imageId.IsRemap())
+    {
+        sprite.ImageType = IMAGE_TYPE_REMAP;
+        uint8_t paletteIndex;
+        if (imageId.HasSecondary())
+        {
+            paletteIndex = imageId.GetPrimary();
+        }
+        else
+        {
+            paletteIndex = imageId.GetRemap();
+        }
+        if (auto pm = GetPaletteMapForColour(paletteIndex); pm.has_value())
+        {
+            sprite.Palette = pm.value();
+        }
+    }
+    else
+    {
+        sprite.ImageType = IMAGE_TYPE_DEFAULT;
+    }
 
     const G1Element* g1 = GfxGetG1Element(imageId);
     if (g1 == nullptr)
@@ -1640,11 +2013,11 @@ static bool IsSpriteInteractedWithPaletteSet(
         return false;
     }
 
-    ZoomLevel zoomLevel = dpi.zoom_level;
-    ScreenCoordsXY interactionPoint{ dpi.x, dpi.y };
+    ZoomLevel zoomLevel = zoom;
     ScreenCoordsXY origin = coords;
+    int32_t zoomShift = 0;
 
-    if (dpi.zoom_level > ZoomLevel{ 0 })
+    if (zoom > ZoomLevel{ 0 })
     {
         if (g1->flags & G1_FLAG_NO_ZOOM_DRAW)
         {
@@ -1660,16 +2033,26 @@ static bool IsSpriteInteractedWithPaletteSet(
                 return false;
             }
             zoomLevel = zoomLevel - 1;
-            interactionPoint.x >>= 1;
-            interactionPoint.y >>= 1;
+            zoomShift++;
             origin.x >>= 1;
             origin.y >>= 1;
         }
     }
 
-    origin.x += g1->x_offset;
-    origin.y += g1->y_offset;
-    interactionPoint -= origin;
+    sprite.G1 = g1;
+    sprite.Origin = { origin.x + g1->x_offset, origin.y + g1->y_offset };
+    sprite.ZoomShift = zoomShift;
+    return true;
+}
+
+/**
+ * rct2: 0x00679074
+ */
+static bool IsInteractionSpriteHit(const InteractionSprite& sprite, const ScreenCoordsXY& coords)
+{
+    const G1Element* g1 = sprite.G1;
+    ScreenCoordsXY interactionPoint{ coords.x >> sprite.ZoomShift, coords.y >> sprite.ZoomShift };
+    interactionPoint -= sprite.Origin;
 
     if (interactionPoint.x < 0 || interactionPoint.y < 0 || interactionPoint.x >= g1->width || interactionPoint.y >= g1->height)
     {
@@ -1683,46 +2066,20 @@ static bool IsSpriteInteractedWithPaletteSet(
 
     if (!(g1->flags & G1_FLAG_1))
     {
-        return IsPixelPresentBMP(imageType, g1, interactionPoint.x, interactionPoint.y, paletteMap);
+        return IsPixelPresentBMP(sprite.ImageType, g1, interactionPoint.x, interactionPoint.y, sprite.Palette);
     }
 
     Guard::Assert(false, "Invalid image type encountered.");
     return false;
 }
 
-/**
- *
- *  rct2: 0x00679023
- */
-
 static bool IsSpriteInteractedWith(DrawPixelInfo& dpi, ImageId imageId, const ScreenCoordsXY& coords)
 {
     PROFILED_FUNCTION();
 
-    auto paletteMap = PaletteMap::GetDefault();
-    uint8_t imageType;
-    if (imageId.HasPrimary() || imageId.IsRemap())
-    {
-        imageType = IMAGE_TYPE_REMAP;
-        uint8_t paletteIndex;
-        if (imageId.HasSecondary())
-        {
-            paletteIndex = imageId.GetPrimary();
-        }
-        else
-        {
-            paletteIndex = imageId.GetRemap();
-        }
-        if (auto pm = GetPaletteMapForColour(paletteIndex); pm.has_value())
-        {
-            paletteMap = pm.value();
-        }
-    }
-    else
-    {
-        imageType = IMAGE_TYPE_DEFAULT;
-    }
-    return IsSpriteInteractedWithPaletteSet(dpi, imageId, coords, paletteMap, imageType);
+    InteractionSprite sprite;
+    return PrepareInteractionSprite(imageId, coords, dpi.zoom_level, sprite)
+        && IsInteractionSpriteHit(sprite, { dpi.x, dpi.y });
 }
 
 /**
@@ -1772,6 +2129,143 @@ InteractionInfo SetInteractionInfoFromPaintSession(PaintSession* session, uint32
     return info;
 }
 
+/**
+ * Writes a sprite of a paint struct to the pixels it covers, in the way SetInteractionInfoFromPaintSession tests it.
+ */
+static void ViewportWriteInteractionSprite(
+    ViewportInteractionBuffer& buffer, const ViewportInteractionBuffer::Range& columns,
+    const ViewportInteractionBuffer::Range& rows, ZoomLevel zoom, ImageId imageId, const ScreenCoordsXY& coords,
+    const InteractionInfo& info, uint32_t& entry)
+{
+    InteractionSprite sprite;
+    if (!PrepareInteractionSprite(imageId, coords, zoom, sprite))
+        return;
+
+    const auto* g1 = sprite.G1;
+    const auto spriteColumns = buffer.GetColumnRange(
+        sprite.Origin.x << sprite.ZoomShift, (sprite.Origin.x + g1->width) << sprite.ZoomShift);
+    const auto spriteRows = buffer.GetRowRange(
+        sprite.Origin.y << sprite.ZoomShift, (sprite.Origin.y + g1->height) << sprite.ZoomShift);
+    const auto firstColumn = std::max(columns.first, spriteColumns.first);
+    const auto lastColumn = std::min(columns.second, spriteColumns.second);
+    const auto firstRow = std::max(rows.first, spriteRows.first);
+    const auto lastRow = std::min(rows.second, spriteRows.second);
+    if (firstColumn >= lastColumn || firstRow >= lastRow)
+        return;
+
+    const auto set = [&](int32_t column, int32_t row) {
+        if (entry == ViewportInteractionBuffer::kUnknown)
+        {
+            entry = buffer.AddEntry(info);
+        }
+        buffer.Set(column, row, entry);
+    };
+
+    if (!(g1->flags & G1_FLAG_RLE_COMPRESSION))
+    {
+        for (auto row = firstRow; row < lastRow; row++)
+        {
+            for (auto column = firstColumn; column < lastColumn; column++)
+            {
+                if (IsInteractionSpriteHit(sprite, buffer.GetViewCoords(column, row)))
+                {
+                    set(column, row);
+                }
+            }
+        }
+        return;
+    }
+
+    // The sprite column each pixel column is tested against, it never decreases from one column to the next
+    thread_local std::vector<int32_t> spriteX;
+    spriteX.resize(lastColumn - firstColumn);
+    for (auto column = firstColumn; column < lastColumn; column++)
+    {
+        spriteX[column - firstColumn] = (buffer.GetViewCoords(column, firstRow).x >> sprite.ZoomShift) - sprite.Origin.x;
+    }
+
+    // Walk each row's runs once and write the columns that land in them, instead of walking the runs for every pixel
+    for (auto row = firstRow; row < lastRow; row++)
+    {
+        const auto y = (buffer.GetViewCoords(firstColumn, row).y >> sprite.ZoomShift) - sprite.Origin.y;
+        if (y < 0 || y >= g1->height)
+            continue;
+
+        const auto* data8 = g1->offset + reinterpret_cast<const uint16_t*>(g1->offset)[y];
+        auto lastDataLine = false;
+        while (!lastDataLine)
+        {
+            int32_t numPixels = *data8++;
+            const int32_t pixelRunStart = *data8++;
+            lastDataLine = numPixels & 0x80;
+            numPixels &= 0x7F;
+            data8 += numPixels;
+
+            auto it = std::lower_bound(spriteX.begin(), spriteX.end(), pixelRunStart);
+            for (; it != spriteX.end() && *it < pixelRunStart + numPixels; it++)
+            {
+                set(firstColumn + static_cast<int32_t>(it - spriteX.begin()), row);
+            }
+        }
+    }
+}
+
+/**
+ * Records for every pixel of the session what SetInteractionInfoFromPaintSession would find there without a filter.
+ */
+static void ViewportWriteInteractionBuffer(const PaintSession& session, ViewportInteractionBuffer& buffer)
+{
+    PROFILED_FUNCTION();
+
+    const auto& dpi = session.DPI;
+    const auto columns = buffer.GetColumnRange(dpi.x, dpi.x + dpi.width);
+    const auto rows = buffer.GetRowRange(dpi.y, dpi.y + dpi.height);
+    buffer.Fill(columns, rows, ViewportInteractionBuffer::kNothing);
+
+    for (PaintStruct* ps = session.PaintHead; ps != nullptr; ps = ps->NextQuadrantEntry)
+    {
+        PaintStruct* last = ps;
+        for (PaintStruct* child = ps; child != nullptr; child = child->Children)
+        {
+            last = child;
+            if (!PSSpriteTypeIsInFilter(child, ViewportInteractionItemAll)
+                || GetPaintStructVisibility(child, session.ViewFlags) != VisibilityKind::Visible)
+                continue;
+
+            auto entry = ViewportInteractionBuffer::kUnknown;
+            ViewportWriteInteractionSprite(
+                buffer, columns, rows, dpi.zoom_level, child->image_id, child->ScreenPos, { child }, entry);
+        }
+
+        if (last->Attached == nullptr || !PSSpriteTypeIsInFilter(last, ViewportInteractionItemAll)
+            || GetPaintStructVisibility(last, session.ViewFlags) != VisibilityKind::Visible)
+            continue;
+
+        auto entry = ViewportInteractionBuffer::kUnknown;
+        for (AttachedPaintStruct* attached = last->Attached; attached != nullptr; attached = attached->NextEntry)
+        {
+            ViewportWriteInteractionSprite(
+                buffer, columns, rows, dpi.zoom_level, attached->image_id, last->ScreenPos + attached->RelativePos,
+                { last }, entry);
+        }
+    }
+
+    // Images that were culled may be on top there, GetMapCoordinatesFromPosWindow paints those pixels without culling
+    for (const auto& rect : session.CulledImages)
+    {
+        const auto culledColumns = buffer.GetColumnRange(rect.GetLeft(), rect.GetRight());
+        const auto culledRows = buffer.GetRowRange(rect.GetTop(), rect.GetBottom());
+        const auto firstColumn = std::max(columns.first, culledColumns.first);
+        const auto lastColumn = std::min(columns.second, culledColumns.second);
+        const auto firstRow = std::max(rows.first, culledRows.first);
+        const auto lastRow = std::min(rows.second, culledRows.second);
+        if (firstColumn < lastColumn && firstRow < lastRow)
+        {
+            buffer.Fill({ firstColumn, lastColumn }, { firstRow, lastRow }, ViewportInteractionBuffer::kUnknown);
+        }
+    }
+}
+
 /**
  *
  *  rct2: 0x00685ADC
@@ -1790,6 +2284,28 @@ InteractionInfo GetMapCoordinatesFromPos(const ScreenCoordsXY& screenCoords, int
     return GetMapCoordinatesFromPosWindow(window, screenCoords, flags);
 }
 
+/**
+ * Looks the pixel up in the interaction buffer of the viewport, which is created the first time the viewport is
+ * queried. A new buffer is not painted in one go, it fills as parts of the viewport are repainted and as pixels are
+ * looked up the slow way.
+ */
+static std::optional<InteractionInfo> GetInteractionInfoFromBuffer(
+    const Viewport& viewport, const ScreenCoordsXY& pixel, uint16_t filter)
+{
+    if (!Config::Get().general.InteractionBuffer)
+        return std::nullopt;
+
+    auto& buffer = _interactionBuffers[&viewport];
+    if (buffer == nullptr)
+    {
+        buffer = std::make_unique<ViewportInteractionBuffer>();
+    }
+
+    buffer->Prepare(viewport);
+    buffer->MarkQueried();
+    return buffer->Query(viewport, pixel, filter);
+}
+
 InteractionInfo GetMapCoordinatesFromPosWindow(WindowBase* window, const ScreenCoordsXY& screenCoords, int32_t flags)
 {
     InteractionInfo info{};
@@ -1812,6 +2328,12 @@ InteractionInfo GetMapCoordinatesFromPosWindow(WindowBase* window, const ScreenC
             viewLoc.x &= viewport->zoom.ApplyTo(0xFFFFFFFF) & 0xFFFFFFFF;
             viewLoc.y &= viewport->zoom.ApplyTo(0xFFFFFFFF) & 0xFFFFFFFF;
         }
+        if (auto result = GetInteractionInfoFromBuffer(*viewport, screenCoords - viewport->pos, flags & 0xFFFF);
+            result.has_value())
+        {
+            return *result;
+        }
+
         DrawPixelInfo dpi;
         dpi.x = viewLoc.x;
         dpi.y = viewLoc.y;
@@ -1823,6 +2345,12 @@ InteractionInfo GetMapCoordinatesFromPosWindow(WindowBase* window, const ScreenC
         PaintSessionGenerate(*session);
         PaintSessionArrange(*session);
         info = SetInteractionInfoFromPaintSession(session, viewport->flags, flags & 0xFFFF);
+
+        // Keep what was found, so the pixel does not have to be painted again when it is looked up next time
+        if (auto it = _interactionBuffers.find(viewport); it != _interactionBuffers.end())
+        {
+            ViewportWriteInteractionBuffer(*session, *it->second);
+        }
         PaintSessionFree(session);
     }
     return info;
@@ -12,6 +12,7 @@
 #include "../world/Location.hpp"
 #include "Window.h"
 
+#include <chrono>
 #include <limits>
 #include <optional>
 #include <vector>
@@ -140,7 +141,22 @@ void ViewportUpdatePosition(WindowBase* window);
 void ViewportUpdateSmartFollowGuest(WindowBase* window, const Guest& peep);
 void ViewportRotateSingle(WindowBase* window, int32_t direction);
 void ViewportRotateAll(int32_t direction);
-void ViewportRender(DrawPixelInfo& dpi, const Viewport* viewport, const ScreenRect& screenRect);
+/**
+ * Time spent on one column of a viewport paint.
+ */
+struct ViewportPaintColumnTimings
+{
+    std::chrono::steady_clock::duration Generate{};
+    std::chrono::steady_clock::duration Arrange{};
+    std::chrono::steady_clock::duration Draw{};
+};
+
+/**
+ * @param timings If set, receives the time spent on each column, from left to right.
+ */
+void ViewportRender(
+    DrawPixelInfo& dpi, const Viewport* viewport, const ScreenRect& screenRect,
+    std::vector<ViewportPaintColumnTimings>* timings = nullptr);
 
 CoordsXYZ ViewportAdjustForMapHeight(const ScreenCoordsXY& startCoords, uint8_t rotation);
 
@@ -0,0 +1,252 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ViewportInteractionBuffer.h"
+
+#include "../entity/EntityBase.h"
+#include "../entity/EntityRegistry.h"
+#include "../util/Util.h"
+#include "../world/Map.h"
+#include "../world/TileElement.h"
+#include "Window.h"
+
+#include <algorithm>
+#include <cstring>
+
+// Entries are never freed while painting, the table is compacted before painting once it is half full
+static constexpr size_t kMinEntries = 4096;
+static constexpr size_t kMaxEntries = 1 << 18;
+
+void ViewportInteractionBuffer::Prepare(const Viewport& viewport)
+{
+    if (viewport.width == _width && viewport.height == _height && viewport.zoom == _zoom
+        && viewport.rotation == _rotation && viewport.flags == _flags)
+    {
+        if (viewport.viewPos != _origin)
+        {
+            Scroll(viewport.viewPos);
+        }
+        if (_numEntries.load(std::memory_order_relaxed) > _entries.size() / 2)
+        {
+            CompactEntries();
+        }
+        return;
+    }
+
+    _width = std::max(0, viewport.width);
+    _height = std::max(0, viewport.height);
+    _origin = viewport.viewPos;
+    _zoom = viewport.zoom;
+    _rotation = viewport.rotation;
+    _flags = viewport.flags;
+
+    const auto numPixels = static_cast<size_t>(_width) * _height;
+    _pixels.assign(numPixels, kUnknown);
+    _entries.resize(std::clamp(numPixels / 8, kMinEntries, kMaxEntries));
+    _numEntries = 0;
+}
+
+bool ViewportInteractionBuffer::Matches(const Viewport& viewport) const
+{
+    return viewport.width == _width && viewport.height == _height && viewport.viewPos == _origin
+        && viewport.zoom == _zoom && viewport.rotation == _rotation && viewport.flags == _flags;
+}
+
+/**
+ * Moves the pixels along with the view, pixels that scroll into view are unknown until they are painted.
+ */
+void ViewportInteractionBuffer::Scroll(const ScreenCoordsXY& newOrigin)
+{
+    ScreenCoordsXY delta;
+    if (_zoom >= ZoomLevel{ 0 })
+    {
+        const auto shift = static_cast<int8_t>(_zoom);
+        delta = { (newOrigin.x >> shift) - (_origin.x >> shift), (newOrigin.y >> shift) - (_origin.y >> shift) };
+    }
+    else
+    {
+        const auto shift = -static_cast<int8_t>(_zoom);
+        delta = { (newOrigin.x - _origin.x) << shift, (newOrigin.y - _origin.y) << shift };
+    }
+    _origin = newOrigin;
+
+    if (std::abs(delta.x) >= _width || std::abs(delta.y) >= _height)
+    {
+        std::fill(_pixels.begin(), _pixels.end(), kUnknown);
+        return;
+    }
+
+    // Rows are moved in the order that reads every row before it is overwritten
+    const auto numColumns = static_cast<size_t>(_width - std::abs(delta.x));
+    const auto dstColumn = std::max(0, -delta.x);
+    const auto srcColumn = std::max(0, delta.x);
+    for (int32_t i = 0; i < _height; i++)
+    {
+        const auto row = delta.y > 0 ? i : _height - 1 - i;
+        auto* dst = &_pixels[static_cast<size_t>(row) * _width];
+        const auto srcRow = row + delta.y;
+        if (srcRow < 0 || srcRow >= _height)
+        {
+            std::fill_n(dst, _width, kUnknown);
+            continue;
+        }
+
+        const auto* src = &_pixels[static_cast<size_t>(srcRow) * _width + srcColumn];
+        std::memmove(dst + dstColumn, src, numColumns * sizeof(uint32_t));
+        std::fill_n(delta.x > 0 ? dst + numColumns : dst, _width - numColumns, kUnknown);
+    }
+}
+
+/**
+ * Removes the entries that no pixel refers to anymore.
+ */
+void ViewportInteractionBuffer::CompactEntries()
+{
+    std::vector<uint32_t> remap(GetNumEntries(), kUnknown);
+    std::vector<Entry> kept;
+    for (auto& pixel : _pixels)
+    {
+        if (pixel < kFirstEntry)
+            continue;
+
+        auto& newValue = remap[pixel - kFirstEntry];
+        if (newValue == kUnknown)
+        {
+            newValue = static_cast<uint32_t>(kept.size() + kFirstEntry);
+            kept.push_back(_entries[pixel - kFirstEntry]);
+        }
+        pixel = newValue;
+    }
+    std::copy(kept.begin(), kept.end(), _entries.begin());
+    _numEntries = kept.size();
+}
+
+ViewportInteractionBuffer::Range ViewportInteractionBuffer::GetRange(
+    int32_t begin, int32_t end, int32_t origin, int32_t size) const
+{
+    int32_t first;
+    int32_t last;
+    if (_zoom >= ZoomLevel{ 0 })
+    {
+        // Pixels are tested at view coordinates rounded down to the zoom level
+        const auto shift = static_cast<int8_t>(_zoom);
+        first = -((-begin) >> shift) - (origin >> shift);
+        last = -((-end) >> shift) - (origin >> shift);
+    }
+    else
+    {
+        const auto shift = -static_cast<int8_t>(_zoom);
+        first = (begin - origin) << shift;
+        last = (end - origin) << shift;
+    }
+    first = std::clamp(first, 0, size);
+    last = std::clamp(last, first, size);
+    return { first, last };
+}
+
+ViewportInteractionBuffer::Range ViewportInteractionBuffer::GetColumnRange(int32_t begin, int32_t end) const
+{
+    return GetRange(begin, end, _origin.x, _width);
+}
+
+ViewportInteractionBuffer::Range ViewportInteractionBuffer::GetRowRange(int32_t begin, int32_t end) const
+{
+    return GetRange(begin, end, _origin.y, _height);
+}
+
+ScreenCoordsXY ViewportInteractionBuffer::GetViewCoords(int32_t column, int32_t row) const
+{
+    if (_zoom >= ZoomLevel{ 0 })
+    {
+        const auto shift = static_cast<int8_t>(_zoom);
+        return { ((_origin.x >> shift) + column) << shift, ((_origin.y >> shift) + row) << shift };
+    }
+
+    const auto shift = -static_cast<int8_t>(_zoom);
+    return { _origin.x + (column >> shift), _origin.y + (row >> shift) };
+}
+
+uint32_t ViewportInteractionBuffer::AddEntry(const InteractionInfo& info)
+{
+    const auto index = _numEntries.fetch_add(1, std::memory_order_relaxed);
+    if (index >= _entries.size())
+    {
+        return kUnknown;
+    }
+
+    auto& entry = _entries[index];
+    entry.Info = info;
+    if (info.Element != nullptr)
+    {
+        entry.ElementType = info.Element->GetType();
+        entry.ElementBaseHeight = info.Element->BaseHeight;
+    }
+    if (info.Entity != nullptr)
+    {
+        entry.EntityGeneration = EntityGetGeneration(info.Entity);
+    }
+    return static_cast<uint32_t>(index + kFirstEntry);
+}
+
+void ViewportInteractionBuffer::Fill(const Range& columns, const Range& rows, uint32_t value)
+{
+    for (auto row = rows.first; row < rows.second; row++)
+    {
+        auto* pixels = &_pixels[static_cast<size_t>(row) * _width];
+        std::fill(pixels + columns.first, pixels + columns.second, value);
+    }
+}
+
+/**
+ * Returns whether the element is still where it was painted, elements move in memory when others are inserted or
+ * removed and the pixel may not have been painted again since.
+ */
+static bool IsElementUnchanged(const TileElement* element, const CoordsXY& loc, TileElementType type, uint8_t baseHeight)
+{
+    auto* tileElement = MapGetFirstElementAt(loc);
+    if (tileElement == nullptr)
+        return false;
+
+    do
+    {
+        if (tileElement == element)
+            return element->GetType() == type && element->BaseHeight == baseHeight;
+    } while (!(tileElement++)->IsLastForTile());
+    return false;
+}
+
+std::optional<InteractionInfo> ViewportInteractionBuffer::Query(
+    const Viewport& viewport, const ScreenCoordsXY& pixel, uint16_t filter) const
+{
+    if (!Matches(viewport) || pixel.x < 0 || pixel.y < 0 || pixel.x >= _width || pixel.y >= _height)
+        return std::nullopt;
+
+    const auto value = Get(pixel.x, pixel.y);
+    if (value == kUnknown)
+        return std::nullopt;
+    if (value == kNothing)
+        return InteractionInfo{};
+
+    // Only the topmost item is known, anything under it needs the pixel to be painted again
+    const auto& entry = _entries[value - kFirstEntry];
+    if (!(filter & EnumToFlag(entry.Info.SpriteType)))
+        return std::nullopt;
+
+    if (entry.Info.Element != nullptr
+        && !IsElementUnchanged(entry.Info.Element, entry.Info.Loc, entry.ElementType, entry.ElementBaseHeight))
+        return std::nullopt;
+
+    // The entity may have been removed and its slot given to a new one since the pixel was painted
+    if (entry.Info.Entity != nullptr
+        && (entry.Info.Entity->Type == EntityType::Null
+            || EntityGetGeneration(entry.Info.Entity) != entry.EntityGeneration))
+        return std::nullopt;
+
+    return entry.Info;
+}
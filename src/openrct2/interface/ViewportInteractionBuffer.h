@@ -0,0 +1,120 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../world/Location.hpp"
+#include "Viewport.h"
+#include "ZoomLevel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+enum class TileElementType : uint8_t;
+
+/**
+ * Holds for every pixel of a viewport what GetMapCoordinatesFromPosWindow would find there. It is written while the
+ * viewport is painted, so hovering and clicking can look the result up instead of painting the pixel again.
+ */
+class ViewportInteractionBuffer
+{
+public:
+    using Range = std::pair<int32_t, int32_t>;
+
+    // Pixel values, values from kFirstEntry on refer to an entry
+    static constexpr uint32_t kUnknown = 0;
+    static constexpr uint32_t kNothing = 1;
+    static constexpr uint32_t kFirstEntry = 2;
+
+    /**
+     * Matches the buffer to the viewport before it is painted. Pixels are kept when the viewport has only been
+     * scrolled, any other change discards them.
+     */
+    void Prepare(const Viewport& viewport);
+
+    /**
+     * Returns the range of pixel columns or rows whose view coordinates are in [begin, end).
+     */
+    Range GetColumnRange(int32_t begin, int32_t end) const;
+    Range GetRowRange(int32_t begin, int32_t end) const;
+
+    /**
+     * Returns the view coordinates that a click on the given pixel is tested against.
+     */
+    ScreenCoordsXY GetViewCoords(int32_t column, int32_t row) const;
+
+    /**
+     * Adds an entry and returns the pixel value that refers to it, or kUnknown when there is no room left. Safe to
+     * call from several paint tasks at once.
+     */
+    uint32_t AddEntry(const InteractionInfo& info);
+
+    void Fill(const Range& columns, const Range& rows, uint32_t value);
+
+    void Set(int32_t column, int32_t row, uint32_t value)
+    {
+        _pixels[static_cast<size_t>(row) * _width + column] = value;
+    }
+
+    uint32_t Get(int32_t column, int32_t row) const
+    {
+        return _pixels[static_cast<size_t>(row) * _width + column];
+    }
+
+    /**
+     * Looks up what is at the given pixel of the viewport. Returns nothing when the buffer can not answer, e.g. the
+     * pixel has not been painted yet or the topmost item there is not in the filter.
+     */
+    std::optional<InteractionInfo> Query(const Viewport& viewport, const ScreenCoordsXY& pixel, uint16_t filter) const;
+
+    void MarkQueried()
+    {
+        _lastQuery = std::chrono::steady_clock::now();
+    }
+
+    std::chrono::steady_clock::time_point GetLastQuery() const
+    {
+        return _lastQuery;
+    }
+
+    size_t GetNumEntries() const
+    {
+        return std::min(_numEntries.load(std::memory_order_relaxed), _entries.size());
+    }
+
+private:
+    struct Entry
+    {
+        InteractionInfo Info;
+        TileElementType ElementType{};
+        uint8_t ElementBaseHeight{};
+        uint32_t EntityGeneration{};
+    };
+
+    int32_t _width{};
+    int32_t _height{};
+    ScreenCoordsXY _origin{};
+    ZoomLevel _zoom{};
+    uint8_t _rotation{};
+    uint32_t _flags{};
+    std::vector<uint32_t> _pixels;
+    std::vector<Entry> _entries;
+    std::atomic<size_t> _numEntries{};
+    std::chrono::steady_clock::time_point _lastQuery = std::chrono::steady_clock::now();
+
+    bool Matches(const Viewport& viewport) const;
+    void Scroll(const ScreenCoordsXY& newOrigin);
+    void CompactEntries();
+    Range GetRange(int32_t begin, int32_t end, int32_t origin, int32_t size) const;
+};
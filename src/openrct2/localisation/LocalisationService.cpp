@@ -155,6 +155,8 @@ std::tuple<StringId, StringId, StringId> LocalisationService::GetLocalisedScenar
 
 StringId LocalisationService::AllocateObjectString(const std::string& target)
 {
+    // Objects can be loaded on several threads at once.
+    std::lock_guard<std::mutex> lock(_objectStringsMutex);
     if (_availableObjectStringIds.empty())
     {
         return STR_EMPTY;
@@ -177,6 +179,7 @@ void LocalisationService::FreeObjectString(StringId stringId)
 {
     if (stringId != STR_EMPTY)
     {
+        std::lock_guard<std::mutex> lock(_objectStringsMutex);
         size_t index = stringId - BASE_OBJECT_STRING_ID;
         if (index < _objectStrings.size())
         {
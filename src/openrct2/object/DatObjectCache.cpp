@@ -0,0 +1,166 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "DatObjectCache.h"
+
+#include "../Diagnostic.h"
+#include "../core/Crypt.h"
+#include "../core/File.h"
+#include "../core/FileStream.h"
+#include "../core/MemoryMappedFile.h"
+#include "../core/MemoryStream.h"
+#include "../core/Path.hpp"
+#include "../rct12/SawyerChunkReader.h"
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+
+namespace OpenRCT2::DatObjectCache
+{
+    static constexpr uint32_t kMagicNumber = 0x43424F44; // DOBC
+    static constexpr uint32_t kVersion = 2;
+
+    using Hash = Crypt::FNV1aAlgorithm::Result;
+
+    /**
+     * Cache files are this header followed by the decoded chunk, so the chunk can be used straight from the mapping.
+     */
+    struct CacheFileHeader
+    {
+        uint32_t MagicNumber;
+        uint32_t Version;
+        uint64_t SourceSize;
+        Hash SourceHash;
+        uint64_t DataLength;
+        RCTObjectEntry Entry;
+    };
+    static_assert(sizeof(CacheFileHeader) == 48);
+
+    static std::atomic<uint32_t> _nextTempFileIndex{ 0 };
+
+    /**
+     * Cache files are named after the path of the DAT file rather than its contents, so the entry of an edited file is
+     * replaced instead of leaving the old one behind. The header tells whether the entry still matches the file.
+     */
+    static u8string GetCacheFilePath(u8string_view cacheDirectory, u8string_view path)
+    {
+        const auto absolutePath = Path::GetAbsolute(path);
+        const auto pathHash = Crypt::FNV1a(absolutePath.data(), absolutePath.size());
+        return Path::Combine(cacheDirectory, String::StringFromHex(pathHash) + ".bin");
+    }
+
+    static bool TryReadCacheFile(const u8string& cachePath, size_t sourceSize, const Hash& sourceHash, DatObjectData& result)
+    {
+        if (!File::Exists(cachePath))
+        {
+            return false;
+        }
+
+        try
+        {
+            auto file = std::make_shared<MemoryMappedFile>(cachePath);
+            if (file->GetLength() < sizeof(CacheFileHeader))
+            {
+                return false;
+            }
+
+            CacheFileHeader header;
+            std::memcpy(&header, file->GetData(), sizeof(header));
+            if (header.MagicNumber != kMagicNumber || header.Version != kVersion || header.SourceSize != sourceSize
+                || header.SourceHash != sourceHash || header.DataLength != file->GetLength() - sizeof(CacheFileHeader))
+            {
+                return false;
+            }
+
+            result.Entry = header.Entry;
+            result.Data = file->GetData() + sizeof(CacheFileHeader);
+            result.Length = static_cast<size_t>(header.DataLength);
+            result.Owner = std::move(file);
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Unable to read object cache file '%s': %s", cachePath.c_str(), e.what());
+            return false;
+        }
+    }
+
+    static void WriteCacheFile(
+        u8string_view cacheDirectory, const u8string& cachePath, size_t sourceSize, const Hash& sourceHash,
+        const DatObjectData& object)
+    {
+        // Objects can be read from several threads at once, give each writer its own temporary file.
+        const auto tempPath = cachePath + "." + std::to_string(_nextTempFileIndex++) + ".tmp";
+        try
+        {
+            Path::CreateDirectory(cacheDirectory);
+
+            CacheFileHeader header{};
+            header.MagicNumber = kMagicNumber;
+            header.Version = kVersion;
+            header.SourceSize = sourceSize;
+            header.SourceHash = sourceHash;
+            header.DataLength = object.Length;
+            header.Entry = object.Entry;
+            {
+                auto fs = FileStream(tempPath, FILE_MODE_WRITE);
+                fs.WriteValue(header);
+                fs.Write(object.Data, object.Length);
+            }
+
+            if (!File::Move(tempPath, cachePath))
+            {
+                File::Delete(tempPath);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Unable to write object cache file '%s': %s", cachePath.c_str(), e.what());
+            File::Delete(tempPath);
+        }
+    }
+
+    DatObjectData Read(u8string_view path, u8string_view cacheDirectory)
+    {
+        MemoryMappedFile source(path);
+        if (source.GetLength() < sizeof(RCTObjectEntry))
+        {
+            throw std::runtime_error("Object file is too small.");
+        }
+
+        u8string cachePath;
+        Hash sourceHash{};
+        DatObjectData result;
+        if (!cacheDirectory.empty())
+        {
+            sourceHash = Crypt::FNV1a(source.GetData(), source.GetLength());
+            cachePath = GetCacheFilePath(cacheDirectory, path);
+            if (TryReadCacheFile(cachePath, source.GetLength(), sourceHash, result))
+            {
+                return result;
+            }
+        }
+
+        auto stream = MemoryStream(source.GetData(), source.GetLength());
+        result.Entry = stream.ReadValue<RCTObjectEntry>();
+
+        auto chunkReader = SawyerChunkReader(&stream);
+        std::shared_ptr<const SawyerChunk> chunk = chunkReader.ReadChunk();
+        result.Data = static_cast<const uint8_t*>(chunk->GetData());
+        result.Length = chunk->GetLength();
+        result.Owner = std::move(chunk);
+
+        if (!cacheDirectory.empty())
+        {
+            WriteCacheFile(cacheDirectory, cachePath, source.GetLength(), sourceHash, result);
+        }
+        return result;
+    }
+} // namespace OpenRCT2::DatObjectCache
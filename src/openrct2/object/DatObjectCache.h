@@ -0,0 +1,44 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../core/String.hpp"
+#include "Object.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace OpenRCT2
+{
+    /**
+     * The entry and decoded chunk of a legacy DAT object.
+     */
+    struct DatObjectData
+    {
+        RCTObjectEntry Entry{};
+        const uint8_t* Data{};
+        size_t Length{};
+
+        // Keeps Data alive, either the mapped cache file or the decoded chunk.
+        std::shared_ptr<const void> Owner;
+    };
+
+    namespace DatObjectCache
+    {
+        /**
+         * Reads a DAT object. Decoded chunks are stored in the cache directory, one entry per DAT file, reading an
+         * unchanged file again maps the decoded chunk from there instead of decoding the file. Once the file changes
+         * its entry is replaced.
+         * @param cacheDirectory Directory for the cache files, the cache is not used if empty.
+         */
+        DatObjectData Read(u8string_view path, u8string_view cacheDirectory);
+    } // namespace DatObjectCache
+} // namespace OpenRCT2
@@ -0,0 +1,108 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ImageDataPool.h"
+
+#include "../core/Crypt.h"
+
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace OpenRCT2::ImageDataPool
+{
+    struct Entry
+    {
+        std::weak_ptr<uint8_t[]> Data;
+        size_t Length{};
+    };
+
+    // Objects are loaded from several threads at once. A multimap rather than a map of vectors, as most hashes only
+    // have one entry and the vector would cost another allocation for each image.
+    static std::mutex _mutex;
+    static std::unordered_multimap<uint64_t, Entry> _entries;
+    static size_t _addsSinceSweep{};
+
+    static uint64_t GetHash(const uint8_t* data, size_t length)
+    {
+        const auto result = Crypt::FNV1a(data, length);
+        uint64_t hash;
+        static_assert(sizeof(result) == sizeof(hash));
+        std::memcpy(&hash, result.data(), sizeof(hash));
+        return hash;
+    }
+
+    /**
+     * Removes the entries of freed buffers, cost is spread over the adds so the pool does not grow while objects are
+     * loaded and unloaded.
+     */
+    static void SweepIfNeeded()
+    {
+        if (++_addsSinceSweep < _entries.size())
+            return;
+
+        _addsSinceSweep = 0;
+        for (auto it = _entries.begin(); it != _entries.end();)
+        {
+            if (it->second.Data.expired())
+                it = _entries.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    Buffer Add(const uint8_t* data, size_t length)
+    {
+        const auto hash = GetHash(data, length);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto [it, last] = _entries.equal_range(hash);
+        while (it != last)
+        {
+            auto existing = it->second.Data.lock();
+            if (existing == nullptr)
+            {
+                it = _entries.erase(it);
+                continue;
+            }
+            if (it->second.Length == length && std::memcmp(existing.get(), data, length) == 0)
+            {
+                return existing;
+            }
+            ++it;
+        }
+
+        // Not make_shared, the weak references in the pool would keep the data allocated otherwise
+        auto buffer = Buffer(new uint8_t[length]);
+        std::memcpy(buffer.get(), data, length);
+        _entries.emplace(hash, Entry{ buffer, length });
+
+        SweepIfNeeded();
+        return buffer;
+    }
+
+    Stats GetStats()
+    {
+        Stats stats;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto& [hash, entry] : _entries)
+        {
+            const auto references = static_cast<size_t>(entry.Data.use_count());
+            if (references == 0)
+                continue;
+
+            stats.UniqueImages++;
+            stats.UniqueBytes += entry.Length;
+            stats.ReferencedImages += references;
+            stats.ReferencedBytes += references * entry.Length;
+        }
+        return stats;
+    }
+} // namespace OpenRCT2::ImageDataPool
@@ -0,0 +1,45 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace OpenRCT2::ImageDataPool
+{
+    using Buffer = std::shared_ptr<uint8_t[]>;
+
+    struct Stats
+    {
+        // Distinct image payloads currently held
+        size_t UniqueImages{};
+        size_t UniqueBytes{};
+        // Images referring to those payloads, including duplicates
+        size_t ReferencedImages{};
+        size_t ReferencedBytes{};
+
+        size_t GetSavedBytes() const
+        {
+            return ReferencedBytes - UniqueBytes;
+        }
+    };
+
+    /**
+     * Returns a buffer holding a copy of the given image data. Images with byte-identical data share the same
+     * buffer, which is freed once the last image referring to it releases it. The data must not be modified.
+     */
+    Buffer Add(const uint8_t* data, size_t length);
+
+    /**
+     * Counts the buffers that are still referenced and how many bytes sharing them saves.
+     */
+    Stats GetStats();
+} // namespace OpenRCT2::ImageDataPool
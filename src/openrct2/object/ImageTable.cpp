@@ -24,7 +24,9 @@
 #include "Object.h"
 #include "ObjectFactory.h"
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 
 using namespace OpenRCT2;
@@ -401,15 +403,124 @@ std::string ImageTable::FindLegacyObject(const std::string& name)
     return objectPath;
 }
 
-ImageTable::~ImageTable()
+/**
+ * Same as G1CalculateDataSize but checks the image lies within the data read from the object.
+ */
+static std::optional<size_t> GetLegacyImageDataSize(const G1Element& g1, const uint8_t* dataBegin, const uint8_t* dataEnd)
 {
-    if (_data == nullptr)
+    if (g1.offset < dataBegin || g1.offset > dataEnd || g1.width < 0 || g1.height < 0)
     {
-        for (auto& entry : _entries)
+        return std::nullopt;
+    }
+
+    const auto available = static_cast<size_t>(dataEnd - g1.offset);
+    size_t length;
+    if (g1.flags & G1_FLAG_PALETTE)
+    {
+        length = g1.width * 3;
+    }
+    else if (g1.flags & G1_FLAG_RLE_COMPRESSION)
+    {
+        if (g1.height == 0)
+        {
+            return 0;
+        }
+        if (available < static_cast<size_t>(g1.height) * 2)
+        {
+            return std::nullopt;
+        }
+
+        // Rows are not always stored in order, the image ends where the row that ends last does
+        length = static_cast<size_t>(g1.height) * 2;
+        for (int32_t row = 0; row < g1.height; row++)
         {
-            delete[] entry.offset;
+            size_t offset = g1.offset[row * 2] | (g1.offset[row * 2 + 1] << 8);
+            bool endOfLine = false;
+            do
+            {
+                if (offset + 2 > available)
+                {
+                    return std::nullopt;
+                }
+                uint8_t chunk0 = g1.offset[offset];
+                offset += 2 + (chunk0 & 0x7F);
+                endOfLine = (chunk0 & 0x80) != 0;
+            } while (!endOfLine);
+            length = std::max(length, offset);
         }
     }
+    else
+    {
+        length = g1.width * g1.height;
+    }
+
+    if (length > available)
+    {
+        return std::nullopt;
+    }
+    return length;
+}
+
+/**
+ * Copies the data of an image, images large enough are shared with identical images of other tables.
+ */
+uint8_t* ImageTable::AddImageData(const uint8_t* data, size_t length)
+{
+    _dataSize += length;
+    if (length < kMinSharedImageLength)
+    {
+        auto& buffer = _data.emplace_back(std::make_unique<uint8_t[]>(length));
+        std::copy_n(data, length, buffer.get());
+        return buffer.get();
+    }
+
+    auto buffer = ImageDataPool::Add(data, length);
+    auto* result = buffer.get();
+    _sharedData.push_back(std::move(buffer));
+    return result;
+}
+
+ImageTable::~ImageTable()
+{
+    ReleaseData();
+}
+
+/**
+ * Frees the pixel data of all images, the image elements themselves are kept.
+ */
+void ImageTable::ReleaseData()
+{
+    _sharedData.clear();
+    _data.clear();
+
+    for (auto& entry : _entries)
+    {
+        entry.offset = nullptr;
+    }
+}
+
+/**
+ * Takes over the pixel data of another table that was read from the same source.
+ */
+bool ImageTable::TakeData(ImageTable& other)
+{
+    if (other._entries.size() != _entries.size())
+    {
+        return false;
+    }
+
+    ReleaseData();
+    for (size_t i = 0; i < _entries.size(); i++)
+    {
+        _entries[i].offset = other._entries[i].offset;
+    }
+    _sharedData = std::move(other._sharedData);
+    _data = std::move(other._data);
+    _dataSize = other._dataSize;
+
+    other._entries.clear();
+    other._dataSize = 0;
+    return true;
 }
 
 void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
@@ -421,6 +532,7 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
 
     try
     {
+        _legacyOffset = stream->GetPosition();
         uint32_t numImages = stream->ReadValue<uint32_t>();
         uint32_t imageDataSize = stream->ReadValue<uint32_t>();
 
@@ -471,8 +583,68 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
             context->LogWarning(ObjectError::BadImageTable, "Image table size shorter than expected.");
         }
 
-        _data = std::move(data);
+        // Split the data into images, so identical images of other objects can share theirs
+        std::vector<size_t> lengths;
+        lengths.reserve(newEntries.size());
+        size_t smallImagesLength = 0;
+        const auto* dataEnd = data.get() + dataSize;
+        for (const auto& g1Element : newEntries)
+        {
+            auto length = GetLegacyImageDataSize(g1Element, data.get(), dataEnd);
+            if (!length.has_value())
+            {
+                break;
+            }
+            lengths.push_back(*length);
+            if (*length < kMinSharedImageLength)
+            {
+                smallImagesLength += *length;
+            }
+        }
+
+        if (lengths.size() != newEntries.size())
+        {
+            context->LogVerbose(ObjectError::BadImageTable, "Image table has images with invalid data.");
+            _data.push_back(std::move(data));
+            _dataSize += dataSize;
+        }
+        else
+        {
+            // Small images are not worth the cost of sharing them, they are packed into one block for the table
+            std::unique_ptr<uint8_t[]> smallImages;
+            size_t smallImagesOffset = 0;
+            if (smallImagesLength != 0)
+            {
+                smallImages = std::make_unique<uint8_t[]>(smallImagesLength);
+            }
+            for (size_t i = 0; i < newEntries.size(); i++)
+            {
+                auto& g1Element = newEntries[i];
+                const auto length = lengths[i];
+                if (length == 0)
+                {
+                    g1Element.offset = nullptr;
+                }
+                else if (length < kMinSharedImageLength)
+                {
+                    auto* dst = smallImages.get() + smallImagesOffset;
+                    std::copy_n(g1Element.offset, length, dst);
+                    g1Element.offset = dst;
+                    smallImagesOffset += length;
+                }
+                else
+                {
+                    g1Element.offset = AddImageData(g1Element.offset, length);
+                }
+            }
+            if (smallImages != nullptr)
+            {
+                _data.push_back(std::move(smallImages));
+                _dataSize += smallImagesLength;
+            }
+        }
         _entries.insert(_entries.end(), newEntries.begin(), newEntries.end());
+        _readCount = _entries.size();
     }
     catch (const std::exception&)
     {
@@ -606,6 +778,7 @@ bool ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
     }
 
     _objDataCache.clear();
+    _readCount = _entries.size();
 
     return usesFallbackSprites;
 }
@@ -620,8 +793,7 @@ void ImageTable::AddImage(const G1Element* g1)
     }
     else
     {
-        newg1.offset = new uint8_t[length];
-        std::copy_n(g1->offset, length, newg1.offset);
+        newg1.offset = AddImageData(g1->offset, length);
     }
     _entries.push_back(std::move(newg1));
 }
@@ -11,6 +11,7 @@
 
 #include "../core/JsonFwd.hpp"
 #include "../drawing/Drawing.h"
+#include "ImageDataPool.h"
 
 #include <memory>
 #include <vector>
@@ -25,8 +26,18 @@ namespace OpenRCT2
 class ImageTable
 {
 private:
-    std::unique_ptr<uint8_t[]> _data;
+    // Sharing an image costs about 110 bytes for its buffer, pool entry and reference, smaller images are not shared
+    static constexpr size_t kMinSharedImageLength = 1024;
+
+    // Image data shared with identical images of other tables
+    std::vector<OpenRCT2::ImageDataPool::Buffer> _sharedData;
+    // Image data only used by this table: small images, and the whole block of legacy tables that are malformed
+    std::vector<std::unique_ptr<uint8_t[]>> _data;
     std::vector<G1Element> _entries;
+    size_t _dataSize{};
+    // Position of a legacy table within its object's chunk, and the number of images read from the object file
+    uint64_t _legacyOffset{};
+    size_t _readCount{};
 
     /**
      * Container for a G1 image, additional information and RAII. Used by ReadJson
@@ -46,6 +57,7 @@ private:
     [[nodiscard]] static std::string FindLegacyObject(const std::string& name);
     [[nodiscard]] static std::vector<std::unique_ptr<ImageTable::RequiredImage>> LoadImageArchiveImages(
         IReadObjectContext* context, const std::string& path, const std::vector<int32_t>& range = {});
+    uint8_t* AddImageData(const uint8_t* data, size_t length);
 
 public:
     ImageTable() = default;
@@ -66,5 +78,25 @@ public:
     {
         return static_cast<uint32_t>(_entries.size());
     }
+    /**
+     * Size of the pixel data of all images while it is loaded.
+     */
+    size_t GetDataSize() const
+    {
+        return _dataSize;
+    }
+    uint64_t GetLegacyOffset() const
+    {
+        return _legacyOffset;
+    }
+    /**
+     * Whether all images were read from the object file, images added afterwards can not be read again.
+     */
+    bool CanReadDataAgain() const
+    {
+        return _readCount == _entries.size();
+    }
     void AddImage(const G1Element* g1);
+    void ReleaseData();
+    bool TakeData(ImageTable& other);
 };
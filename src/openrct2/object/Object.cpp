@@ -21,6 +21,7 @@
 #include "../localisation/LocalisationService.h"
 #include "../localisation/StringIds.h"
 #include "../world/Scenery.h"
+#include "ObjectFactory.h"
 #include "ObjectLimits.h"
 #include "ObjectRepository.h"
 
@@ -28,6 +29,7 @@
 #include <cassert>
 #include <cstring>
 #include <stdexcept>
+#include <utility>
 
 using namespace OpenRCT2;
 
@@ -207,22 +209,87 @@ std::string Object::GetName(int32_t language) const
     return GetString(language, ObjectStringID::NAME);
 }
 
+void Object::ReserveImages()
+{
+    if (_baseImageId == ImageIndexUndefined && _reservedImageId == ImageIndexUndefined)
+    {
+        _reservedImageId = GfxObjectReserveImages(GetImageTable().GetCount());
+    }
+}
+
+void Object::RegisterReservedImages()
+{
+    if (_imageSourcePending)
+    {
+        if (_imageTable.CanReadDataAgain())
+        {
+            GfxObjectRegisterImageSource(_baseImageId, GetImageTable().GetCount(), this);
+        }
+        _imageSourcePending = false;
+    }
+}
+
 ImageIndex Object::LoadImages()
 {
     if (_baseImageId == ImageIndexUndefined)
     {
-        _baseImageId = GfxObjectAllocateImages(GetImageTable().GetImages(), GetImageTable().GetCount());
+        if (_reservedImageId != ImageIndexUndefined)
+        {
+            GfxObjectSetImages(_reservedImageId, GetImageTable().GetImages(), GetImageTable().GetCount());
+            _baseImageId = std::exchange(_reservedImageId, ImageIndexUndefined);
+            _imageSourcePending = true;
+        }
+        else
+        {
+            auto* imageSource = _imageTable.CanReadDataAgain() ? this : nullptr;
+            _baseImageId = GfxObjectAllocateImages(GetImageTable().GetImages(), GetImageTable().GetCount(), imageSource);
+        }
     }
     return _baseImageId;
 }
 
 void Object::UnloadImages()
 {
+    if (_reservedImageId != ImageIndexUndefined)
+    {
+        GfxObjectFreeImages(_reservedImageId, GetImageTable().GetCount());
+        _reservedImageId = ImageIndexUndefined;
+    }
     if (_baseImageId != ImageIndexUndefined)
     {
         GfxObjectFreeImages(_baseImageId, GetImageTable().GetCount());
         _baseImageId = ImageIndexUndefined;
+        _imageSourcePending = false;
+    }
+}
+
+const G1Element* Object::GetImages() const
+{
+    return _imageTable.GetImages();
+}
+
+size_t Object::GetImageDataSize() const
+{
+    return _imageTable.GetDataSize();
+}
+
+/**
+ * Reads the images from the object's repository file again to get back the pixel data released by UnloadImageData.
+ */
+bool Object::LoadImageData()
+{
+    auto& objectRepository = OpenRCT2::GetContext()->GetObjectRepository();
+    const auto* ori = objectRepository.FindObject(GetDescriptor());
+    if (ori == nullptr)
+    {
+        return false;
     }
+    return OpenRCT2::ObjectFactory::ReloadImageTable(objectRepository, ori->Path, _identifier, _imageTable);
+}
+
+void Object::UnloadImageData()
+{
+    _imageTable.ReleaseData();
 }
 
 void RCTObjectEntry::SetName(std::string_view value)
@@ -11,6 +11,7 @@
 
 #include "../core/JsonFwd.hpp"
 #include "../core/String.hpp"
+#include "../drawing/Image.h"
 #include "../drawing/ImageIndexType.h"
 #include "../util/Util.h"
 #include "ImageTable.h"
@@ -184,7 +185,7 @@ struct IReadObjectContext
 #    pragma GCC diagnostic ignored "-Wsuggest-final-types"
 #    pragma GCC diagnostic ignored "-Wsuggest-final-methods"
 #endif
-class Object
+class Object : private IImageSource
 {
 private:
     std::string _identifier;
@@ -198,6 +199,8 @@ private:
     bool _usesFallbackImages{};
     bool _isCompatibilityObject{};
     ImageIndex _baseImageId{ ImageIndexUndefined };
+    ImageIndex _reservedImageId{ ImageIndexUndefined };
+    bool _imageSourcePending{};
 
 protected:
     StringTable& GetStringTable()
@@ -333,8 +336,21 @@ public:
         return _baseImageId;
     }
 
+    /**
+     * Allocates the image slots used by the next LoadImages call. Slot allocation is not thread safe, reserving the
+     * images of a batch of objects up front allows their Load to run in parallel. RegisterReservedImages must be
+     * called once the batch is loaded.
+     */
+    void ReserveImages();
+    void RegisterReservedImages();
     uint32_t LoadImages();
     void UnloadImages();
+
+private:
+    const G1Element* GetImages() const override;
+    size_t GetImageDataSize() const override;
+    bool LoadImageData() override;
+    void UnloadImageData() override;
 };
 #ifdef __WARN_SUGGEST_FINAL_TYPES__
 #    pragma GCC diagnostic pop
@@ -16,16 +16,15 @@
 #include "../audio/audio.h"
 #include "../core/Console.hpp"
 #include "../core/File.h"
-#include "../core/FileStream.h"
 #include "../core/Json.hpp"
 #include "../core/Memory.hpp"
 #include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../core/Zip.h"
-#include "../rct12/SawyerChunkReader.h"
 #include "AudioObject.h"
 #include "BannerObject.h"
+#include "DatObjectCache.h"
 #include "EntranceObject.h"
 #include "FootpathObject.h"
 #include "FootpathRailingsObject.h"
@@ -255,6 +254,16 @@ namespace OpenRCT2::ObjectFactory
         }
     }
 
+    static u8string GetDatObjectCacheDirectory()
+    {
+        auto* context = GetContext();
+        if (context == nullptr)
+        {
+            return {};
+        }
+        return context->GetPlatformEnvironment()->GetDirectoryPath(DIRBASE::CACHE, DIRID::OBJECT);
+    }
+
     std::unique_ptr<Object> CreateObjectFromLegacyFile(IObjectRepository& objectRepository, const utf8* path, bool loadImages)
     {
         LOG_VERBOSE("CreateObjectFromLegacyFile(..., \"%s\")", path);
@@ -262,10 +271,8 @@ namespace OpenRCT2::ObjectFactory
         std::unique_ptr<Object> result;
         try
         {
-            auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
-            auto chunkReader = SawyerChunkReader(&fs);
-
-            RCTObjectEntry entry = fs.ReadValue<RCTObjectEntry>();
+            auto object = DatObjectCache::Read(path, GetDatObjectCacheDirectory());
+            const auto& entry = object.Entry;
 
             if (entry.GetType() != ObjectType::ScenarioText)
             {
@@ -275,11 +282,9 @@ namespace OpenRCT2::ObjectFactory
                 utf8 objectName[kDatNameLength + 1] = { 0 };
                 ObjectEntryGetNameFixed(objectName, sizeof(objectName), &entry);
                 LOG_VERBOSE("  entry: { 0x%08X, \"%s\", 0x%08X }", entry.flags, objectName, entry.checksum);
+                LOG_VERBOSE("  size: %zu", object.Length);
 
-                auto chunk = chunkReader.ReadChunk();
-                LOG_VERBOSE("  size: %zu", chunk->GetLength());
-
-                auto chunkStream = OpenRCT2::MemoryStream(chunk->GetData(), chunk->GetLength());
+                auto chunkStream = OpenRCT2::MemoryStream(object.Data, object.Length);
                 auto readContext = ReadObjectContext(objectRepository, objectName, loadImages, nullptr);
                 ReadObjectLegacy(*result, &readContext, &chunkStream);
                 if (readContext.WasError())
@@ -472,6 +477,54 @@ namespace OpenRCT2::ObjectFactory
         return nullptr;
     }
 
+    bool ReloadImageTable(
+        IObjectRepository& objectRepository, const std::string& path, const std::string& identifier, ImageTable& imageTable)
+    {
+        try
+        {
+            std::unique_ptr<IZipArchive> archive;
+            std::unique_ptr<IFileDataRetriever> fileDataRetriever;
+            json_t jRoot;
+            auto extension = Path::GetExtension(path);
+            if (String::IEquals(extension, ".json"))
+            {
+                jRoot = Json::ReadFromFile(path.c_str());
+                fileDataRetriever = std::make_unique<FileSystemDataRetriever>(Path::GetDirectory(path));
+            }
+            else if (String::IEquals(extension, ".parkobj"))
+            {
+                archive = Zip::Open(path, ZIP_ACCESS::READ);
+                jRoot = Json::FromVector(archive->GetFileData("object.json"));
+                fileDataRetriever = std::make_unique<ZipDataRetriever>(path, *archive);
+            }
+
+            ImageTable newTable;
+            auto readContext = ReadObjectContext(objectRepository, identifier, true, fileDataRetriever.get());
+            if (fileDataRetriever != nullptr)
+            {
+                if (!jRoot.is_object())
+                {
+                    throw std::runtime_error("Object JSON root was not an object");
+                }
+                newTable.ReadJson(&readContext, jRoot);
+            }
+            else
+            {
+                // Only the image table is read, it starts where the object's properties ended when it was loaded
+                auto object = DatObjectCache::Read(path, GetDatObjectCacheDirectory());
+                auto chunkStream = OpenRCT2::MemoryStream(object.Data, object.Length);
+                chunkStream.SetPosition(imageTable.GetLegacyOffset());
+                newTable.Read(&readContext, &chunkStream);
+            }
+            return !readContext.WasError() && imageTable.TakeData(newTable);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Unable to read the images of '%s' again: %s", path.c_str(), e.what());
+        }
+        return false;
+    }
+
     static void ExtractSourceGames(const std::string& id, json_t& jRoot, Object& result)
     {
         auto sourceGames = jRoot["sourceGame"];
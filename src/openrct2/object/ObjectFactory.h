@@ -15,6 +15,7 @@
 #include <string_view>
 
 struct IObjectRepository;
+class ImageTable;
 class Object;
 struct RCTObjectEntry;
 enum class ObjectType : uint8_t;
@@ -31,4 +32,11 @@ namespace OpenRCT2::ObjectFactory
 
     [[nodiscard]] std::unique_ptr<Object> CreateObjectFromJsonFile(
         IObjectRepository& objectRepository, const std::string& path, bool loadImages);
+
+    /**
+     * Reads only the images of an object file again and hands their pixel data to the image table the object was
+     * created with.
+     */
+    [[nodiscard]] bool ReloadImageTable(
+        IObjectRepository& objectRepository, const std::string& path, const std::string& identifier, ImageTable& imageTable);
 } // namespace OpenRCT2::ObjectFactory
@@ -14,14 +14,16 @@
 #include "../ParkImporter.h"
 #include "../audio/audio.h"
 #include "../core/Console.hpp"
-#include "../core/JobPool.h"
+#include "../core/JobScheduler.h"
 #include "../core/Memory.hpp"
 #include "../interface/Window.h"
 #include "../localisation/StringIds.h"
+#include "../paint/Paint.TileCache.h"
 #include "../ride/Ride.h"
 #include "../ride/RideAudio.h"
 #include "../util/Util.h"
 #include "BannerSceneryEntry.h"
+#include "ImageDataPool.h"
 #include "LargeSceneryObject.h"
 #include "Object.h"
 #include "ObjectLimits.h"
@@ -35,6 +37,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -198,6 +201,7 @@ public:
         // Update indices.
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        PaintTileCacheInvalidate();
     }
 
     void UnloadObjects(const std::vector<ObjectEntryDescriptor>& entries) override
@@ -225,6 +229,7 @@ public:
         {
             UpdateSceneryGroupIndexes();
             ResetTypeToRideEntryIndexMap();
+            PaintTileCacheInvalidate();
         }
     }
 
@@ -253,6 +258,7 @@ public:
         }
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        PaintTileCacheInvalidate();
 
         // We will need to replay the title music if the title music object got reloaded
         OpenRCT2::Audio::StopTitleMusic();
@@ -331,6 +337,7 @@ private:
         }
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        PaintTileCacheInvalidate();
     }
 
     Object* LoadObject(ObjectEntryIndex slot, std::string_view identifier)
@@ -376,6 +383,7 @@ private:
                 list[*slot] = object;
                 UpdateSceneryGroupIndexes();
                 ResetTypeToRideEntryIndexMap();
+                PaintTileCacheInvalidate();
             }
         }
         return loadedObject;
@@ -598,7 +606,7 @@ private:
         objectsToLoad.erase(std::unique(objectsToLoad.begin(), objectsToLoad.end()), objectsToLoad.end());
 
         // Prepare for loading objects multi-threaded
-        auto numProcessed = 0;
+        std::atomic<size_t> numProcessed{ 0 };
         auto numRequired = objectsToLoad.size();
         std::mutex commonMutex;
         auto loadSingleObject = [&](const ObjectRepositoryItem* requiredObject) {
@@ -622,20 +630,23 @@ private:
             numProcessed++;
         };
 
-        auto completionFn = [&]() {
-            if (reportProgress && (numProcessed % 100) == 0)
-                ReportProgress(numProcessed, numRequired);
-        };
-
         // Dispatch loading the objects
-        JobPool jobs{};
+        TaskGroup tasks;
         for (auto* object : objectsToLoad)
         {
-            jobs.AddTask([object, &loadSingleObject]() { loadSingleObject(object); }, completionFn);
+            tasks.Run([object, &loadSingleObject]() { loadSingleObject(object); });
         }
 
         // Wait until all jobs are fully completed
-        jobs.Join();
+        size_t lastReported = 0;
+        tasks.Wait([&]() {
+            const size_t processed = numProcessed;
+            if (reportProgress && processed / 100 != lastReported / 100)
+            {
+                ReportProgress(processed, numRequired);
+                lastReported = processed;
+            }
+        });
 
         // Assign the loaded objects to the required objects
         for (auto& requiredObject : requiredObjects)
@@ -654,11 +665,26 @@ private:
             objects.push_back(loadedObject);
         }
 
-        // Load objects
+        // Load objects, image slots are assigned up front so the objects can set up their images in parallel.
+        std::vector<Object*> parallelObjects;
+        std::vector<Object*> serialObjects;
         for (auto* obj : newLoadedObjects)
+        {
+            obj->ReserveImages();
+            if (CanLoadInParallel(obj->GetObjectType()))
+                parallelObjects.push_back(obj);
+            else
+                serialObjects.push_back(obj);
+        }
+        ParallelFor(0, parallelObjects.size(), [&parallelObjects](size_t i) { parallelObjects[i]->Load(); });
+        for (auto* obj : serialObjects)
         {
             obj->Load();
         }
+        for (auto* obj : newLoadedObjects)
+        {
+            obj->RegisterReservedImages();
+        }
 
         if (!badObjects.empty())
         {
@@ -701,6 +727,11 @@ private:
         }
 
         LOG_VERBOSE("%u / %u new objects loaded", newLoadedObjects.size(), requiredObjects.size());
+
+        const auto imageStats = ImageDataPool::GetStats();
+        LOG_VERBOSE(
+            "%zu / %zu object images share their data, saving %zu bytes", imageStats.ReferencedImages - imageStats.UniqueImages,
+            imageStats.ReferencedImages, imageStats.GetSavedBytes());
     }
 
     Object* GetOrLoadObject(const ObjectRepositoryItem* ori)
@@ -755,6 +786,23 @@ private:
         }
     }
 
+    /**
+     * Audio, music and water objects set up audio sources or the palette while loading, which must not happen on
+     * several threads at once.
+     */
+    static bool CanLoadInParallel(ObjectType type)
+    {
+        switch (type)
+        {
+            case ObjectType::Audio:
+            case ObjectType::Music:
+            case ObjectType::Water:
+                return false;
+            default:
+                return true;
+        }
+    }
+
     static void ReportMissingObject(const ObjectEntryDescriptor& entry)
     {
         std::string name(entry.GetName());
@@ -20,6 +20,7 @@
 #include "../core/Guard.hpp"
 #include "../core/IStream.hpp"
 #include "../core/Memory.hpp"
+#include "../core/MemoryMappedFile.h"
 #include "../core/MemoryStream.h"
 #include "../core/Numerics.hpp"
 #include "../core/Path.hpp"
@@ -39,7 +40,12 @@
 #include "ObjectManager.h"
 #include "RideObject.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -48,29 +54,225 @@
 
 using namespace OpenRCT2;
 
-struct ObjectEntryHash
+static bool HasEntryName(const RCTObjectEntry& entry)
 {
-    size_t operator()(const RCTObjectEntry& entry) const
+    return entry.name[0] != '\0';
+}
+
+static int32_t CompareEntryNames(const RCTObjectEntry& lhs, const RCTObjectEntry& rhs)
+{
+    return memcmp(&lhs.name, &rhs.name, sizeof(lhs.name));
+}
+
+/**
+ * The object index as it is stored on disk. It is memory mapped and queried in place: files and items are fixed size
+ * records that refer to their strings by offset, so the identifier and legacy entry of an item can be looked up
+ * without reading anything else. The remaining fields of an item are read from its serialised data once it is used.
+ */
+class MappedObjectIndex
+{
+public:
+    static constexpr uint32_t kMagicNumber = 0x4D44494F; // OIDM
+    // The file did not contain a valid object.
+    static constexpr uint32_t kNoItem = UINT32_MAX;
+    // The object of the file was not added to the repository as it conflicts with another one.
+    static constexpr uint32_t kRejectedItem = UINT32_MAX - 1;
+
+#pragma pack(push, 1)
+    struct StringRef
     {
-        uint32_t hash = 5381;
-        for (auto i : entry.name)
+        uint32_t Offset;
+        uint32_t Length;
+    };
+
+    struct Header
+    {
+        uint32_t HeaderSize = sizeof(Header);
+        uint32_t MagicNumber = kMagicNumber;
+        uint16_t Version = 0;
+        uint16_t LanguageId = 0;
+        uint32_t NumFiles = 0;
+        uint32_t NumItems = 0;
+        uint32_t NumIdentifiers = 0;
+        uint32_t NumEntries = 0;
+        uint32_t Padding = 0;
+        uint64_t FilesOffset = 0;
+        uint64_t ItemsOffset = 0;
+        uint64_t IdentifiersOffset = 0;
+        uint64_t EntriesOffset = 0;
+        uint64_t StringsOffset = 0;
+        uint64_t StringsLength = 0;
+        uint64_t DataOffset = 0;
+        uint64_t DataLength = 0;
+    };
+    static_assert(sizeof(Header) == 96);
+
+    // Files are sorted by path.
+    struct FileRecord
+    {
+        StringRef Path;
+        uint64_t Size;
+        uint64_t LastModified;
+        uint32_t ItemIndex;
+    };
+    static_assert(sizeof(FileRecord) == 28);
+
+    // Items are in repository order, the tables hold their indices sorted by identifier and legacy entry name.
+    struct ItemRecord
+    {
+        StringRef Identifier;
+        RCTObjectEntry ObjectEntry;
+        uint64_t DataOffset;
+        uint64_t DataLength;
+    };
+    static_assert(sizeof(ItemRecord) == 40);
+#pragma pack(pop)
+
+private:
+    MemoryMappedFile _file;
+    Header _header{};
+    const FileRecord* _files{};
+    const ItemRecord* _items{};
+    const uint32_t* _identifierTable{};
+    const uint32_t* _entryTable{};
+    const char* _strings{};
+    const uint8_t* _data{};
+
+public:
+    /**
+     * Maps the given index, throws if the index is damaged. An index of another version or language is mapped but
+     * not usable.
+     */
+    MappedObjectIndex(u8string_view path, uint16_t version, int32_t language)
+        : _file(path)
+    {
+        if (_file.GetLength() < sizeof(Header))
+            throw IOException("Object index is truncated.");
+
+        std::memcpy(&_header, _file.GetData(), sizeof(Header));
+        if (!IsUpToDate(version, language))
+            return;
+
+        _files = GetSection<FileRecord>(_header.FilesOffset, _header.NumFiles);
+        _items = GetSection<ItemRecord>(_header.ItemsOffset, _header.NumItems);
+        _identifierTable = GetSection<uint32_t>(_header.IdentifiersOffset, _header.NumIdentifiers);
+        _entryTable = GetSection<uint32_t>(_header.EntriesOffset, _header.NumEntries);
+        _strings = reinterpret_cast<const char*>(GetSection<uint8_t>(_header.StringsOffset, _header.StringsLength));
+        _data = GetSection<uint8_t>(_header.DataOffset, _header.DataLength);
+
+        // Check every reference up front, so lookups can trust the index
+        for (uint32_t i = 0; i < _header.NumFiles; i++)
         {
-            hash = ((hash << 5) + hash) + i;
+            CheckString(_files[i].Path);
+            if (_files[i].ItemIndex >= _header.NumItems && _files[i].ItemIndex != kNoItem
+                && _files[i].ItemIndex != kRejectedItem)
+                throw IOException("Object index refers to an invalid item.");
+        }
+        for (uint32_t i = 0; i < _header.NumItems; i++)
+        {
+            CheckString(_items[i].Identifier);
+            if (_items[i].DataOffset > _header.DataLength || _items[i].DataLength > _header.DataLength - _items[i].DataOffset)
+                throw IOException("Object index item data is out of bounds.");
+        }
+        for (const auto& table : { GetIdentifierTable(), GetEntryTable() })
+        {
+            if (std::any_of(table.begin(), table.end(), [this](uint32_t index) { return index >= _header.NumItems; }))
+                throw IOException("Object index refers to an invalid item.");
         }
-        return hash;
     }
-};
 
-struct ObjectEntryEqual
-{
-    bool operator()(const RCTObjectEntry& lhs, const RCTObjectEntry& rhs) const
+    bool IsUpToDate(uint16_t version, int32_t language) const
     {
-        return memcmp(&lhs.name, &rhs.name, 8) == 0;
+        return _header.HeaderSize == sizeof(Header) && _header.MagicNumber == kMagicNumber && _header.Version == version
+            && _header.LanguageId == language;
     }
-};
 
-using ObjectIdentifierMap = std::unordered_map<std::string, size_t>;
-using ObjectEntryMap = std::unordered_map<RCTObjectEntry, size_t, ObjectEntryHash, ObjectEntryEqual>;
+    size_t GetNumFiles() const
+    {
+        return _header.NumFiles;
+    }
+
+    size_t GetNumItems() const
+    {
+        return _header.NumItems;
+    }
+
+    const FileRecord& GetFile(size_t index) const
+    {
+        return _files[index];
+    }
+
+    std::string_view GetString(const StringRef& ref) const
+    {
+        return std::string_view(_strings + ref.Offset, ref.Length);
+    }
+
+    std::string_view GetIdentifier(size_t index) const
+    {
+        return GetString(_items[index].Identifier);
+    }
+
+    const RCTObjectEntry& GetObjectEntry(size_t index) const
+    {
+        return _items[index].ObjectEntry;
+    }
+
+    std::span<const uint8_t> GetItemData(size_t index) const
+    {
+        return { _data + _items[index].DataOffset, static_cast<size_t>(_items[index].DataLength) };
+    }
+
+    std::span<const uint32_t> GetIdentifierTable() const
+    {
+        return { _identifierTable, _header.NumIdentifiers };
+    }
+
+    std::span<const uint32_t> GetEntryTable() const
+    {
+        return { _entryTable, _header.NumEntries };
+    }
+
+    /**
+     * Checks whether the index was written for exactly the given files.
+     */
+    template<typename TFileRecord> bool Matches(const std::vector<TFileRecord>& files) const
+    {
+        if (files.size() != _header.NumFiles)
+            return false;
+
+        std::vector<const TFileRecord*> sortedFiles;
+        sortedFiles.reserve(files.size());
+        for (const auto& file : files)
+            sortedFiles.push_back(&file);
+        std::sort(sortedFiles.begin(), sortedFiles.end(), [](const TFileRecord* a, const TFileRecord* b) {
+            return a->Path < b->Path;
+        });
+
+        for (size_t i = 0; i < sortedFiles.size(); i++)
+        {
+            const auto& file = _files[i];
+            if (GetString(file.Path) != sortedFiles[i]->Path || file.Size != sortedFiles[i]->Size
+                || file.LastModified != sortedFiles[i]->LastModified)
+                return false;
+        }
+        return true;
+    }
+
+private:
+    template<typename T> const T* GetSection(uint64_t offset, uint64_t count) const
+    {
+        const auto length = _file.GetLength();
+        if (offset > length || count > (length - offset) / sizeof(T))
+            throw IOException("Object index section is out of bounds.");
+        return reinterpret_cast<const T*>(_file.GetData() + offset);
+    }
+
+    void CheckString(const StringRef& ref) const
+    {
+        if (ref.Offset > _header.StringsLength || ref.Length > _header.StringsLength - ref.Offset)
+            throw IOException("Object index string is out of bounds.");
+    }
+};
 
 class ObjectFileIndex final : public FileIndex<ObjectRepositoryItem>
 {
@@ -82,6 +284,12 @@ private:
     IObjectRepository& _objectRepository;
 
 public:
+    using FileIndex::FileRecord;
+    using FileIndex::IndexedFile;
+
+    using FileIndex::CreateItems;
+    using FileIndex::Scan;
+
     explicit ObjectFileIndex(IObjectRepository& objectRepository, const IPlatformEnvironment& env)
         : FileIndex(
             "object index", MAGIC_NUMBER, VERSION, env.GetFilePath(PATHID::CACHE_OBJECTS), std::string(PATTERN),
@@ -131,6 +339,173 @@ public:
         return std::nullopt;
     }
 
+    /**
+     * Maps the index written by WriteMappedIndex, returns nullptr if there is no usable index.
+     */
+    std::unique_ptr<MappedObjectIndex> OpenMappedIndex(int32_t language) const
+    {
+        const auto& path = GetIndexPath();
+        if (!File::Exists(path))
+            return nullptr;
+
+        try
+        {
+            LOG_VERBOSE("FileIndex:Mapping index: '%s'", path.c_str());
+            auto index = std::make_unique<MappedObjectIndex>(path, VERSION, language);
+            if (index->IsUpToDate(VERSION, language))
+                return index;
+
+            Console::WriteLine("%s out of date", GetName().c_str());
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to load index: '%s'.", path.c_str());
+            Console::Error::WriteLine("%s", e.what());
+        }
+        return nullptr;
+    }
+
+    void ReadMappedItem(const MappedObjectIndex& index, size_t itemIndex, ObjectRepositoryItem& item) const
+    {
+        auto data = index.GetItemData(itemIndex);
+        auto ms = MemoryStream(data.data(), data.size());
+        DataSerialiser ds(false, ms);
+        Serialise(ds, item);
+        item.Id = itemIndex;
+    }
+
+    /**
+     * Reads the files of a mapped index so their items can be reused when the index is built again. Files of rejected
+     * items are left out, they are loaded again in case the conflicting object is gone.
+     */
+    std::unordered_map<std::string, IndexedFile> ReadMappedFiles(const MappedObjectIndex& index) const
+    {
+        std::unordered_map<std::string, IndexedFile> indexedFiles;
+        indexedFiles.reserve(index.GetNumFiles());
+        for (size_t i = 0; i < index.GetNumFiles(); i++)
+        {
+            const auto& file = index.GetFile(i);
+            if (file.ItemIndex == MappedObjectIndex::kRejectedItem)
+                continue;
+
+            IndexedFile indexedFile;
+            indexedFile.File.Path = index.GetString(file.Path);
+            indexedFile.File.Size = file.Size;
+            indexedFile.File.LastModified = file.LastModified;
+            if (file.ItemIndex != MappedObjectIndex::kNoItem)
+            {
+                ObjectRepositoryItem item = {};
+                ReadMappedItem(index, file.ItemIndex, item);
+                indexedFile.Item = std::move(item);
+            }
+            auto path = indexedFile.File.Path;
+            indexedFiles.emplace(std::move(path), std::move(indexedFile));
+        }
+        return indexedFiles;
+    }
+
+    /**
+     * Writes the index for the given files and the items of the repository that were created from them.
+     */
+    void WriteMappedIndex(
+        int32_t language, const std::vector<IndexedFile>& indexedFiles, const std::vector<ObjectRepositoryItem>& items,
+        std::span<const uint32_t> identifierTable, std::span<const uint32_t> entryTable) const
+    {
+        const auto& path = GetIndexPath();
+        try
+        {
+            LOG_VERBOSE("FileIndex:Writing index: '%s'", path.c_str());
+
+            std::string strings;
+            auto addString = [&strings](std::string_view value) {
+                MappedObjectIndex::StringRef ref{ static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(value.size()) };
+                strings.append(value);
+                return ref;
+            };
+
+            // Items keep their repository order, everything but the keys is serialised into the data section
+            std::unordered_map<std::string_view, uint32_t> itemIndices;
+            std::vector<MappedObjectIndex::ItemRecord> itemRecords(items.size());
+            MemoryStream data;
+            DataSerialiser ds(true, data);
+            for (size_t i = 0; i < items.size(); i++)
+            {
+                auto& record = itemRecords[i];
+                record.Identifier = addString(items[i].Identifier);
+                record.ObjectEntry = items[i].ObjectEntry;
+                record.DataOffset = data.GetPosition();
+                Serialise(ds, items[i]);
+                record.DataLength = data.GetPosition() - record.DataOffset;
+                itemIndices.emplace(items[i].Path, static_cast<uint32_t>(i));
+            }
+
+            std::vector<const IndexedFile*> sortedFiles;
+            sortedFiles.reserve(indexedFiles.size());
+            for (const auto& indexedFile : indexedFiles)
+                sortedFiles.push_back(&indexedFile);
+            std::sort(sortedFiles.begin(), sortedFiles.end(), [](const IndexedFile* a, const IndexedFile* b) {
+                return a->File.Path < b->File.Path;
+            });
+
+            std::vector<MappedObjectIndex::FileRecord> fileRecords(sortedFiles.size());
+            for (size_t i = 0; i < sortedFiles.size(); i++)
+            {
+                const auto& file = sortedFiles[i]->File;
+                auto& record = fileRecords[i];
+                record.Path = addString(file.Path);
+                record.Size = file.Size;
+                record.LastModified = file.LastModified;
+                record.ItemIndex = MappedObjectIndex::kNoItem;
+                // The repository may hold the item already, so only its file tells whether it was created
+                if (sortedFiles[i]->Item.has_value())
+                {
+                    auto it = itemIndices.find(file.Path);
+                    record.ItemIndex = it != itemIndices.end() ? it->second : MappedObjectIndex::kRejectedItem;
+                }
+            }
+
+            MappedObjectIndex::Header header;
+            header.Version = VERSION;
+            header.LanguageId = language;
+            header.NumFiles = static_cast<uint32_t>(fileRecords.size());
+            header.NumItems = static_cast<uint32_t>(itemRecords.size());
+            header.NumIdentifiers = static_cast<uint32_t>(identifierTable.size());
+            header.NumEntries = static_cast<uint32_t>(entryTable.size());
+            header.FilesOffset = sizeof(header);
+            header.ItemsOffset = header.FilesOffset + fileRecords.size() * sizeof(MappedObjectIndex::FileRecord);
+            header.IdentifiersOffset = header.ItemsOffset + itemRecords.size() * sizeof(MappedObjectIndex::ItemRecord);
+            header.EntriesOffset = header.IdentifiersOffset + identifierTable.size_bytes();
+            header.StringsOffset = header.EntriesOffset + entryTable.size_bytes();
+            header.StringsLength = strings.size();
+            header.DataOffset = header.StringsOffset + header.StringsLength;
+            header.DataLength = data.GetLength();
+
+            // Write next to the index and move it in place, other instances may have the current index mapped
+            Path::CreateDirectory(Path::GetDirectory(path));
+            auto tempPath = path + ".tmp";
+            {
+                auto fs = FileStream(tempPath, FILE_MODE_WRITE);
+                fs.WriteValue(header);
+                fs.Write(fileRecords.data(), fileRecords.size() * sizeof(MappedObjectIndex::FileRecord));
+                fs.Write(itemRecords.data(), itemRecords.size() * sizeof(MappedObjectIndex::ItemRecord));
+                fs.Write(identifierTable.data(), identifierTable.size_bytes());
+                fs.Write(entryTable.data(), entryTable.size_bytes());
+                fs.Write(strings.data(), strings.size());
+                fs.Write(data.GetData(), data.GetLength());
+            }
+            if (!File::Move(tempPath, path))
+            {
+                File::Delete(tempPath);
+                throw IOException("Unable to replace " + path);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to save index: '%s'.", path.c_str());
+            Console::Error::WriteLine("%s", e.what());
+        }
+    }
+
 protected:
     void Serialise(DataSerialiser& ds, const ObjectRepositoryItem& item) const override
     {
@@ -177,9 +552,15 @@ class ObjectRepository final : public IObjectRepository
 {
     std::shared_ptr<IPlatformEnvironment> const _env;
     ObjectFileIndex const _fileIndex;
-    std::vector<ObjectRepositoryItem> _items;
-    ObjectIdentifierMap _newItemMap;
-    ObjectEntryMap _itemMap;
+    // Items of a mapped index are only filled in once they are used, lookups may do so from any thread.
+    mutable std::vector<ObjectRepositoryItem> _items;
+    // Item indices sorted by identifier and by legacy entry name, for binary searching.
+    std::vector<uint32_t> _identifierTable;
+    std::vector<uint32_t> _entryTable;
+    // While set, the keys and lookup tables are read from the mapped index instead.
+    std::unique_ptr<MappedObjectIndex> _mappedIndex;
+    std::unique_ptr<std::atomic<bool>[]> _mappedItemsRead;
+    mutable std::mutex _mappedItemsMutex;
 
 public:
     explicit ObjectRepository(const std::shared_ptr<IPlatformEnvironment>& env)
@@ -196,16 +577,25 @@ public:
     void LoadOrConstruct(int32_t language) override
     {
         ClearItems();
-        auto items = _fileIndex.LoadOrBuild(language);
-        AddItems(items);
-        SortItems();
+
+        auto files = _fileIndex.Scan();
+        auto mappedIndex = _fileIndex.OpenMappedIndex(language);
+        if (mappedIndex != nullptr && mappedIndex->Matches(files))
+        {
+            UseMappedIndex(std::move(mappedIndex));
+            return;
+        }
+
+        auto previousFiles = mappedIndex != nullptr ? _fileIndex.ReadMappedFiles(*mappedIndex)
+                                                    : std::unordered_map<std::string, ObjectFileIndex::IndexedFile>{};
+        mappedIndex = nullptr;
+        BuildIndex(language, files, std::move(previousFiles));
     }
 
     void Construct(int32_t language) override
     {
-        auto items = _fileIndex.Rebuild(language);
-        AddItems(items);
-        SortItems();
+        ClearItems();
+        BuildIndex(language, _fileIndex.Scan(), {});
     }
 
     size_t GetNumObjects() const override
@@ -215,6 +605,7 @@ public:
 
     const ObjectRepositoryItem* GetObjects() const override
     {
+        ReadAllMappedItems();
         return _items.data();
     }
 
@@ -223,30 +614,25 @@ public:
         RCTObjectEntry entry = {};
         entry.SetName(legacyIdentifier);
 
-        auto kvp = _itemMap.find(entry);
-        if (kvp != _itemMap.end())
-        {
-            return &_items[kvp->second];
-        }
-        return nullptr;
+        return FindObject(&entry);
     }
 
     const ObjectRepositoryItem* FindObject(std::string_view identifier) const override final
     {
-        auto kvp = _newItemMap.find(std::string(identifier));
-        if (kvp != _newItemMap.end())
+        auto range = FindIdentifierRange(identifier);
+        if (!range.empty())
         {
-            return &_items[kvp->second];
+            return GetItem(range.front());
         }
         return nullptr;
     }
 
     const ObjectRepositoryItem* FindObject(const RCTObjectEntry* objectEntry) const override final
     {
-        auto kvp = _itemMap.find(*objectEntry);
-        if (kvp != _itemMap.end())
+        auto range = FindEntryRange(*objectEntry);
+        if (!range.empty())
         {
-            return &_items[kvp->second];
+            return GetItem(range.front());
         }
         return nullptr;
     }
@@ -357,8 +743,93 @@ private:
     void ClearItems()
     {
         _items.clear();
-        _newItemMap.clear();
-        _itemMap.clear();
+        _identifierTable.clear();
+        _entryTable.clear();
+        _mappedIndex = nullptr;
+        _mappedItemsRead = nullptr;
+    }
+
+    void BuildIndex(
+        int32_t language, const std::vector<ObjectFileIndex::FileRecord>& files,
+        std::unordered_map<std::string, ObjectFileIndex::IndexedFile>&& previousFiles)
+    {
+        std::vector<ObjectFileIndex::IndexedFile> indexedFiles;
+        _fileIndex.CreateItems(language, files, std::move(previousFiles), indexedFiles);
+
+        // The files keep their optional items engaged after the move, which the index uses to tell rejected items apart
+        std::vector<ObjectRepositoryItem> items;
+        items.reserve(indexedFiles.size());
+        for (auto& indexedFile : indexedFiles)
+        {
+            if (indexedFile.Item.has_value())
+            {
+                items.push_back(std::move(indexedFile.Item.value()));
+            }
+        }
+        AddItems(std::move(items));
+        SortItems();
+
+        _fileIndex.WriteMappedIndex(language, indexedFiles, _items, _identifierTable, _entryTable);
+    }
+
+    void UseMappedIndex(std::unique_ptr<MappedObjectIndex>&& mappedIndex)
+    {
+        const auto numItems = mappedIndex->GetNumItems();
+        _items.resize(numItems);
+        _mappedItemsRead = std::make_unique<std::atomic<bool>[]>(numItems);
+        _mappedIndex = std::move(mappedIndex);
+    }
+
+    /**
+     * Reads every item from the mapped index and moves its lookup tables into memory, so items can be added.
+     */
+    void UnmapIndex()
+    {
+        if (_mappedIndex == nullptr)
+            return;
+
+        ReadAllMappedItems();
+        auto identifierTable = _mappedIndex->GetIdentifierTable();
+        auto entryTable = _mappedIndex->GetEntryTable();
+        _identifierTable.assign(identifierTable.begin(), identifierTable.end());
+        _entryTable.assign(entryTable.begin(), entryTable.end());
+        _mappedIndex = nullptr;
+        _mappedItemsRead = nullptr;
+    }
+
+    const ObjectRepositoryItem* GetItem(size_t index) const
+    {
+        if (_mappedIndex != nullptr && !_mappedItemsRead[index].load(std::memory_order_acquire))
+        {
+            std::lock_guard lock(_mappedItemsMutex);
+            if (!_mappedItemsRead[index].load(std::memory_order_relaxed))
+            {
+                _fileIndex.ReadMappedItem(*_mappedIndex, index, _items[index]);
+                _mappedItemsRead[index].store(true, std::memory_order_release);
+            }
+        }
+        return &_items[index];
+    }
+
+    void ReadAllMappedItems() const
+    {
+        if (_mappedIndex == nullptr)
+            return;
+
+        for (size_t i = 0; i < _items.size(); i++)
+        {
+            GetItem(i);
+        }
+    }
+
+    std::string_view GetIdentifier(size_t index) const
+    {
+        return _mappedIndex != nullptr ? _mappedIndex->GetIdentifier(index) : std::string_view(_items[index].Identifier);
+    }
+
+    const RCTObjectEntry& GetObjectEntry(size_t index) const
+    {
+        return _mappedIndex != nullptr ? _mappedIndex->GetObjectEntry(index) : _items[index].ObjectEntry;
     }
 
     void SortItems()
@@ -367,95 +838,198 @@ private:
             return String::Compare(a.Name, b.Name) < 0;
         });
 
-        // Fix the IDs
+        // Fix the IDs, the lookup tables only need their indices updated as the keys did not change
+        std::vector<size_t> newIndices(_items.size());
         for (size_t i = 0; i < _items.size(); i++)
         {
+            newIndices[_items[i].Id] = i;
             _items[i].Id = i;
         }
 
-        // Rebuild item map
-        _itemMap.clear();
-        _newItemMap.clear();
+        RemapLookupTables(newIndices);
+    }
+
+    void RebuildLookupTables()
+    {
+        _identifierTable.clear();
+        _entryTable.clear();
         for (size_t i = 0; i < _items.size(); i++)
         {
-            RCTObjectEntry entry = _items[i].ObjectEntry;
-            _itemMap[entry] = i;
             if (!_items[i].Identifier.empty())
             {
-                _newItemMap[_items[i].Identifier] = i;
+                _identifierTable.push_back(static_cast<uint32_t>(i));
+            }
+            if (HasEntryName(_items[i].ObjectEntry))
+            {
+                _entryTable.push_back(static_cast<uint32_t>(i));
             }
         }
+
+        // Stable so that items sharing a key stay in the order they were added.
+        std::stable_sort(_identifierTable.begin(), _identifierTable.end(), [this](uint32_t a, uint32_t b) {
+            return _items[a].Identifier < _items[b].Identifier;
+        });
+        std::stable_sort(_entryTable.begin(), _entryTable.end(), [this](uint32_t a, uint32_t b) {
+            return CompareEntryNames(_items[a].ObjectEntry, _items[b].ObjectEntry) < 0;
+        });
     }
 
-    void AddItems(const std::vector<ObjectRepositoryItem>& items)
+    /**
+     * Points the lookup tables at the new index of each item, items mapped to SIZE_MAX are dropped. The items must keep
+     * their keys, so the tables stay sorted without sorting them again.
+     */
+    void RemapLookupTables(const std::vector<size_t>& newIndices)
     {
-        size_t numConflicts = 0;
-        for (const auto& item : items)
+        for (auto* table : { &_identifierTable, &_entryTable })
         {
-            if (!AddItem(item))
+            size_t count = 0;
+            for (auto index : *table)
             {
-                numConflicts++;
+                if (newIndices[index] != SIZE_MAX)
+                {
+                    (*table)[count++] = static_cast<uint32_t>(newIndices[index]);
+                }
             }
-        }
-        if (numConflicts > 0)
-        {
-            Console::Error::WriteLine("%zu object conflicts found.", numConflicts);
+            table->resize(count);
         }
     }
 
-    bool AddItem(const ObjectRepositoryItem& item)
+    using TableRange = std::span<const uint32_t>;
+
+    TableRange FindIdentifierRange(std::string_view identifier) const
     {
-        const auto newIdent = MapToNewObjectIdentifier(item.Identifier);
-        if (!newIdent.empty())
-        {
-            Console::Error::WriteLine("Mixed install detected. Not loading: '%s'", item.Identifier.c_str());
-            return false;
-        }
-        const ObjectRepositoryItem* conflict{};
-        if (item.ObjectEntry.name[0] != '\0')
-        {
-            conflict = FindObject(&item.ObjectEntry);
-        }
-        if (conflict == nullptr)
+        TableRange table = _mappedIndex != nullptr ? _mappedIndex->GetIdentifierTable() : TableRange(_identifierTable);
+        auto first = std::lower_bound(table.begin(), table.end(), identifier, [this](uint32_t index, std::string_view value) {
+            return GetIdentifier(index) < value;
+        });
+        auto last = std::find_if(first, table.end(), [&](uint32_t index) { return GetIdentifier(index) != identifier; });
+        return TableRange(first, last);
+    }
+
+    TableRange FindEntryRange(const RCTObjectEntry& entry) const
+    {
+        TableRange table = _mappedIndex != nullptr ? _mappedIndex->GetEntryTable() : TableRange(_entryTable);
+        auto first = std::lower_bound(table.begin(), table.end(), entry, [this](uint32_t index, const RCTObjectEntry& value) {
+            return CompareEntryNames(GetObjectEntry(index), value) < 0;
+        });
+        auto last = std::find_if(
+            first, table.end(), [&](uint32_t index) { return CompareEntryNames(GetObjectEntry(index), entry) != 0; });
+        return TableRange(first, last);
+    }
+
+    /**
+     * Appends the given items and drops those that conflict with an item that is already in the repository
+     * or with an earlier item of the list. The lookup tables are built once for the whole list, the items are
+     * not moved until all conflicts have been resolved so the tables stay valid while looking them up.
+     */
+    void AddItems(std::vector<ObjectRepositoryItem>&& items)
+    {
+        const size_t firstNewIndex = _items.size();
+        _items.reserve(_items.size() + items.size());
+        for (auto& item : items)
         {
-            conflict = FindObject(item.Identifier);
+            item.Id = _items.size();
+            _items.push_back(std::move(item));
         }
+        RebuildLookupTables();
 
-        if (conflict == nullptr)
+        // Items are accepted in the order they were added, a rejected item can be superseded by the item that replaced it.
+        std::vector<bool> accepted(_items.size(), false);
+        std::vector<size_t> replacedBy(_items.size(), SIZE_MAX);
+        std::fill_n(accepted.begin(), firstNewIndex, true);
+
+        auto findAccepted = [&](const TableRange& range) -> const ObjectRepositoryItem* {
+            for (size_t index : range)
+            {
+                if (!accepted[index] && replacedBy[index] != SIZE_MAX)
+                    index = replacedBy[index];
+                if (accepted[index])
+                    return &_items[index];
+            }
+            return nullptr;
+        };
+
+        size_t numConflicts = 0;
+        for (size_t i = firstNewIndex; i < _items.size(); i++)
         {
-            size_t index = _items.size();
-            auto copy = item;
-            copy.Id = index;
-            _items.push_back(std::move(copy));
-            if (!item.Identifier.empty())
+            const auto& item = _items[i];
+
+            const auto newIdent = MapToNewObjectIdentifier(item.Identifier);
+            if (!newIdent.empty())
             {
-                _newItemMap[item.Identifier] = index;
+                Console::Error::WriteLine("Mixed install detected. Not loading: '%s'", item.Identifier.c_str());
+                numConflicts++;
+                continue;
             }
-            if (!item.ObjectEntry.IsEmpty())
+
+            const ObjectRepositoryItem* conflict{};
+            if (HasEntryName(item.ObjectEntry))
             {
-                _itemMap[item.ObjectEntry] = index;
+                conflict = findAccepted(FindEntryRange(item.ObjectEntry));
+            }
+            if (conflict == nullptr && !item.Identifier.empty())
+            {
+                conflict = findAccepted(FindIdentifierRange(item.Identifier));
+            }
+
+            if (conflict == nullptr)
+            {
+                accepted[i] = true;
+            }
+            // When there is a conflict between a DAT file and a JSON file, the JSON should take precedence.
+            else if (item.Generation == ObjectGeneration::JSON && conflict->Generation == ObjectGeneration::DAT)
+            {
+                Console::Error::WriteLine("Object conflict: '%s' was overridden by '%s'", conflict->Path.c_str(), item.Path.c_str());
+
+                const auto id = conflict->Id;
+                accepted[id] = false;
+                accepted[i] = true;
+                replacedBy[id] = i;
+            }
+            else
+            {
+                Console::Error::WriteLine("Object conflict: '%s'", conflict->Path.c_str());
+                Console::Error::WriteLine("               : '%s'", item.Path.c_str());
+                numConflicts++;
             }
-            return true;
         }
-        // When there is a conflict between a DAT file and a JSON file, the JSON should take precedence.
-        else if (item.Generation == ObjectGeneration::JSON && conflict->Generation == ObjectGeneration::DAT)
+
+        // Existing items keep their ID as they may already be loaded, the item overriding one takes its place.
+        std::vector<size_t> newIndices(_items.size(), SIZE_MAX);
+        for (size_t id = 0; id < firstNewIndex; id++)
         {
-            const auto id = conflict->Id;
-            const auto oldPath = conflict->Path;
-            _items[id] = item;
-            _items[id].Id = id;
-            if (!item.Identifier.empty())
+            const auto i = replacedBy[id];
+            if (i == SIZE_MAX)
             {
-                _newItemMap[item.Identifier] = id;
+                newIndices[id] = id;
+                continue;
             }
+            _items[id] = std::move(_items[i]);
+            _items[id].Id = id;
+            accepted[i] = false;
+            newIndices[i] = id;
+        }
 
-            Console::Error::WriteLine("Object conflict: '%s' was overridden by '%s'", oldPath.c_str(), item.Path.c_str());
-            return true;
+        // Remove the rejected items
+        size_t count = firstNewIndex;
+        for (size_t i = firstNewIndex; i < _items.size(); i++)
+        {
+            if (accepted[i])
+            {
+                if (count != i)
+                    _items[count] = std::move(_items[i]);
+                _items[count].Id = count;
+                newIndices[i] = count;
+                count++;
+            }
         }
+        _items.erase(_items.begin() + count, _items.end());
+        RemapLookupTables(newIndices);
 
-        Console::Error::WriteLine("Object conflict: '%s'", conflict->Path.c_str());
-        Console::Error::WriteLine("               : '%s'", item.Path.c_str());
-        return false;
+        if (numConflicts > 0)
+        {
+            Console::Error::WriteLine("%zu object conflicts found.", numConflicts);
+        }
     }
 
     void ScanObject(const std::string& path)
@@ -463,7 +1037,11 @@ private:
         auto language = LocalisationService_GetCurrentLanguage();
         if (auto result = _fileIndex.Create(language, path); result.has_value())
         {
-            AddItem(result.value());
+            UnmapIndex();
+
+            std::vector<ObjectRepositoryItem> items;
+            items.push_back(std::move(result.value()));
+            AddItems(std::move(items));
         }
     }
 
@@ -0,0 +1,737 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Paint.TileCache.h"
+
+#include "../Limits.h"
+#include "../OpenRCT2.h"
+#include "../config/Config.h"
+#include "../drawing/LightFX.h"
+#include "../entity/PatrolArea.h"
+#include "../interface/Viewport.h"
+#include "../object/LargeSceneryEntry.h"
+#include "../object/SmallSceneryEntry.h"
+#include "../object/WallSceneryEntry.h"
+#include "../profiling/Profiling.h"
+#include "../ride/Ride.h"
+#include "../ride/RideData.h"
+#include "../ride/Track.h"
+#include "../ride/TrackDesign.h"
+#include "../world/Banner.h"
+#include "../world/Map.h"
+#include "Paint.h"
+#include "VirtualFloor.h"
+#include "tile_element/Paint.TileElement.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+using namespace OpenRCT2;
+
+// Beyond this many recorded tiles the ones that have gone unused the longest are dropped, but never the ones the last
+// paint used, so a view with more visible tiles than this does not record them all again every paint
+static constexpr size_t kMaxCachedTiles = 1 << 16;
+
+// A tile is painted into a few columns and bands, each of them clipping it differently
+static constexpr size_t kMaxTileVariants = 8;
+
+// More tiles invalidated between two updates than this discard the whole cache instead
+static constexpr size_t kMaxInvalidatedTiles = 1 << 12;
+
+static constexpr uint32_t kNoStruct = std::numeric_limits<uint32_t>::max();
+
+/**
+ * Session state a tile leaves behind for the entities and tiles painted after it. Paint structs are stored as indices
+ * into the recording.
+ */
+struct CachedExitState
+{
+    uint32_t LastPS = kNoStruct;
+    uint32_t LastAttachedPS = kNoStruct;
+    uint32_t WoodenSupportsPrependTo = kNoStruct;
+    const SurfaceElement* Surface{};
+    TileElement* CurrentlyDrawnTileElement{};
+    const TileElement* PathElementOnSameHeight{};
+    const TileElement* TrackElementOnSameHeight{};
+    CoordsXY SpritePosition;
+    CoordsXY MapPosition;
+    ImageId TrackColours;
+    ImageId SupportColours;
+    std::array<SupportHeight, 9> SupportSegments{};
+    SupportHeight Support{};
+    uint16_t WaterHeight{};
+    std::array<TunnelEntry, kTunnelMaxCount> LeftTunnels{};
+    std::array<TunnelEntry, kTunnelMaxCount> RightTunnels{};
+    uint8_t LeftTunnelCount{};
+    uint8_t RightTunnelCount{};
+    uint8_t VerticalTunnelHeight{};
+    uint8_t Flags{};
+    ViewportInteractionItem InteractionType{};
+    bool CullImages{};
+};
+
+/**
+ * What a tile painted into a session, along with every clip test it took. It is replayed into any session with the same
+ * view where all of the tests have the same result, the tile then paints exactly the same.
+ */
+struct CachedTile
+{
+    mutable std::atomic<uint32_t> LastUsed{};
+    uint64_t ViewKey{};
+    std::vector<PaintClipTest> ClipTests;
+    std::vector<RideId> Rides;
+    // Parent paint structs with their chain of children, in the order they were added to their quadrants
+    std::vector<uint32_t> NumChained;
+    std::vector<PaintStruct> Structs;
+    std::vector<uint16_t> NumAttached;
+    std::vector<AttachedPaintStruct> Attached;
+    std::vector<ScreenRect> CulledImages;
+    CachedExitState ExitState;
+};
+
+using CachedTileVariants = std::vector<std::unique_ptr<CachedTile>>;
+using GlobalPaintState = std::array<int32_t, 11>;
+using RidePaintState
+    = std::array<uint8_t, sizeof(ride_type_t) + sizeof(ObjectEntryIndex) + sizeof(TrackColour) * kNumRideColourSchemes>;
+
+// Only changed by PaintTileCacheUpdate, so the paint threads can look tiles up without a lock
+static std::unordered_map<uint32_t, CachedTileVariants> _tiles;
+static size_t _numCachedTiles{};
+static GlobalPaintState _globalState{};
+static std::vector<RidePaintState> _rideStates;
+static uint32_t _generation{};
+static std::atomic<bool> _invalidated{};
+
+// Set while anything is cached or recorded, tiles only need to be invalidated then
+static std::atomic<bool> _isCaching{};
+
+// Tiles recorded since the last update, they are kept alive here until they are moved to _tiles
+static std::mutex _recordedMutex;
+static std::unordered_map<uint32_t, CachedTileVariants> _recordedTiles;
+
+static std::mutex _invalidatedMutex;
+static std::vector<uint32_t> _invalidatedTiles;
+
+/**
+ * State outside of the tile elements that changes what tiles paint, a change of any of it invalidates all tiles.
+ */
+static GlobalPaintState GetGlobalPaintState()
+{
+    const auto& config = Config::Get().general;
+    return {
+        gScreenFlags,
+        gClipHeight,
+        gClipSelectionA.x,
+        gClipSelectionA.y,
+        gClipSelectionB.x,
+        gClipSelectionB.y,
+        config.TransparentWater,
+        config.LandscapeSmoothing,
+        static_cast<int32_t>(config.VirtualFloorStyle),
+        config.ShowHeightAsUnits,
+        static_cast<int32_t>(config.MeasurementFormat),
+    };
+}
+
+/**
+ * The state of a ride its track paints from.
+ */
+static RidePaintState GetRidePaintState(const Ride* ride)
+{
+    RidePaintState state;
+    if (ride == nullptr)
+    {
+        state.fill(0xFF);
+        return state;
+    }
+
+    auto* dst = state.data();
+    std::memcpy(dst, &ride->type, sizeof(ride->type));
+    dst += sizeof(ride->type);
+    std::memcpy(dst, &ride->entrance_style, sizeof(ride->entrance_style));
+    dst += sizeof(ride->entrance_style);
+    std::memcpy(dst, ride->track_colour, sizeof(ride->track_colour));
+    return state;
+}
+
+static bool IsPatrolAreaRendered()
+{
+    auto patrolAreaToRender = GetPatrolAreaToRender();
+    if (const auto* staffId = std::get_if<EntityId>(&patrolAreaToRender))
+    {
+        return !staffId->IsNull();
+    }
+    return true;
+}
+
+bool PaintTileCacheIsUsable(const PaintSession& session)
+{
+    if (!Config::Get().general.PaintTileCache)
+        return false;
+    if (session.SelectedElement != nullptr || (session.ViewFlags & VIEWPORT_FLAG_LAND_OWNERSHIP))
+        return false;
+    if (gMapSelectFlags != 0 || gTrackDesignSaveMode || gShowSupportSegmentHeights || gPaintWidePathsAsGhost
+        || gPaintBlockedTiles)
+        return false;
+    if (VirtualFloorIsEnabled() || LightFXIsAvailable() || IsPatrolAreaRendered())
+        return false;
+
+    // The cached tiles are only dropped by the next update, until then tiles paint directly
+    return !_invalidated.load(std::memory_order_relaxed) && GetGlobalPaintState() == _globalState;
+}
+
+static uint32_t GetTileIndex(const TileCoordsXY& tile)
+{
+    return static_cast<uint32_t>(tile.y) * kMaximumMapSizeTechnical + static_cast<uint32_t>(tile.x);
+}
+
+static void DropTile(uint32_t tileIndex)
+{
+    if (auto it = _tiles.find(tileIndex); it != _tiles.end())
+    {
+        _numCachedTiles -= it->second.size();
+        _tiles.erase(it);
+    }
+}
+
+/**
+ * Drops the invalidated tiles along with their neighbours, surfaces and paths paint their edges from the neighbours.
+ */
+static void DropInvalidatedTiles()
+{
+    std::vector<uint32_t> invalidatedTiles;
+    {
+        std::lock_guard<std::mutex> lock(_invalidatedMutex);
+        invalidatedTiles.swap(_invalidatedTiles);
+    }
+
+    for (auto tileIndex : invalidatedTiles)
+    {
+        const auto x = static_cast<int32_t>(tileIndex % kMaximumMapSizeTechnical);
+        const auto y = static_cast<int32_t>(tileIndex / kMaximumMapSizeTechnical);
+        DropTile(tileIndex);
+        for (Direction direction = 0; direction < kNumOrthogonalDirections; direction++)
+        {
+            const auto neighbour = TileCoordsXY{ x, y } + TileDirectionDelta[direction];
+            if (neighbour.x >= 0 && neighbour.y >= 0 && neighbour.x < kMaximumMapSizeTechnical
+                && neighbour.y < kMaximumMapSizeTechnical)
+            {
+                DropTile(GetTileIndex(neighbour));
+            }
+        }
+    }
+}
+
+/**
+ * Compares the rides with the state they had in the last update and returns the ones that have changed.
+ */
+static std::vector<RideId> UpdateRideStates()
+{
+    std::vector<RideId> changedRides;
+    _rideStates.resize(Limits::kMaxRidesInPark, GetRidePaintState(nullptr));
+    for (uint16_t i = 0; i < Limits::kMaxRidesInPark; i++)
+    {
+        const auto rideId = RideId::FromUnderlying(i);
+        const auto state = GetRidePaintState(GetRide(rideId));
+        if (state != _rideStates[i])
+        {
+            _rideStates[i] = state;
+            changedRides.push_back(rideId);
+        }
+    }
+    return changedRides;
+}
+
+/**
+ * Drops the tiles with track of rides that changed colour, type or station style.
+ */
+static void DropTilesOfChangedRides()
+{
+    const auto changedRides = UpdateRideStates();
+    if (changedRides.empty())
+        return;
+
+    for (auto it = _tiles.begin(); it != _tiles.end();)
+    {
+        auto& variants = it->second;
+        const auto oldSize = variants.size();
+        variants.erase(
+            std::remove_if(
+                variants.begin(), variants.end(),
+                [&](const std::unique_ptr<CachedTile>& tile) {
+                    return std::any_of(tile->Rides.begin(), tile->Rides.end(), [&](RideId rideId) {
+                        return std::find(changedRides.begin(), changedRides.end(), rideId) != changedRides.end();
+                    });
+                }),
+            variants.end());
+        _numCachedTiles -= oldSize - variants.size();
+        it = variants.empty() ? _tiles.erase(it) : std::next(it);
+    }
+}
+
+/**
+ * Drops the least recently used tiles until a quarter of the limit is free again, so a full cache is not trimmed
+ * on every update.
+ */
+static void TrimTiles()
+{
+    std::vector<std::tuple<uint32_t, uint32_t, const CachedTile*>> byAge;
+    byAge.reserve(_numCachedTiles);
+    for (const auto& [tileIndex, variants] : _tiles)
+    {
+        for (const auto& tile : variants)
+        {
+            byAge.emplace_back(tile->LastUsed.load(std::memory_order_relaxed), tileIndex, tile.get());
+        }
+    }
+    std::sort(byAge.begin(), byAge.end());
+
+    const auto target = kMaxCachedTiles / 4 * 3;
+    for (const auto& [lastUsed, tileIndex, tile] : byAge)
+    {
+        if (_numCachedTiles <= target || lastUsed == _generation)
+            break;
+
+        auto it = _tiles.find(tileIndex);
+        auto& variants = it->second;
+        variants.erase(std::find_if(variants.begin(), variants.end(), [&](const auto& variant) {
+            return variant.get() == tile;
+        }));
+        _numCachedTiles--;
+        if (variants.empty())
+        {
+            _tiles.erase(it);
+        }
+    }
+}
+
+/**
+ * Adds a recorded tile to the cache, replacing the variant of the tile that has gone unused the longest when it has
+ * too many.
+ */
+static void AddTile(uint32_t tileIndex, std::unique_ptr<CachedTile>&& tile)
+{
+    auto& variants = _tiles[tileIndex];
+    if (variants.size() >= kMaxTileVariants)
+    {
+        auto oldest = std::min_element(variants.begin(), variants.end(), [](const auto& a, const auto& b) {
+            return a->LastUsed.load(std::memory_order_relaxed) < b->LastUsed.load(std::memory_order_relaxed);
+        });
+        *oldest = std::move(tile);
+        return;
+    }
+    variants.push_back(std::move(tile));
+    _numCachedTiles++;
+}
+
+void PaintTileCacheUpdate()
+{
+    PROFILED_FUNCTION();
+
+    std::lock_guard<std::mutex> lock(_recordedMutex);
+    const auto globalState = GetGlobalPaintState();
+    if (_invalidated.exchange(false, std::memory_order_relaxed) || globalState != _globalState)
+    {
+        _tiles.clear();
+        _numCachedTiles = 0;
+        _recordedTiles.clear();
+        _globalState = globalState;
+        UpdateRideStates();
+
+        std::lock_guard<std::mutex> invalidatedLock(_invalidatedMutex);
+        _invalidatedTiles.clear();
+    }
+
+    for (auto& [tileIndex, variants] : _recordedTiles)
+    {
+        for (auto& tile : variants)
+        {
+            AddTile(tileIndex, std::move(tile));
+        }
+    }
+    _recordedTiles.clear();
+
+    DropInvalidatedTiles();
+    DropTilesOfChangedRides();
+    if (_numCachedTiles > kMaxCachedTiles)
+    {
+        TrimTiles();
+    }
+    _isCaching.store(!_tiles.empty(), std::memory_order_relaxed);
+    _generation++;
+}
+
+void PaintTileCacheInvalidateTile(const CoordsXY& mapCoords)
+{
+    if (!_isCaching.load(std::memory_order_relaxed))
+        return;
+
+    const auto tile = TileCoordsXY(mapCoords);
+    if (tile.x < 0 || tile.y < 0 || tile.x >= kMaximumMapSizeTechnical || tile.y >= kMaximumMapSizeTechnical)
+        return;
+
+    std::lock_guard<std::mutex> lock(_invalidatedMutex);
+    if (_invalidatedTiles.size() >= kMaxInvalidatedTiles)
+    {
+        _invalidated.store(true, std::memory_order_relaxed);
+        return;
+    }
+    _invalidatedTiles.push_back(GetTileIndex(tile));
+}
+
+void PaintTileCacheInvalidate()
+{
+    _invalidated.store(true, std::memory_order_relaxed);
+}
+
+/**
+ * Elements whose paint depends on the tick count, ride vehicles or banner text.
+ */
+static bool IsElementReplayable(const TileElement& element)
+{
+    switch (element.GetType())
+    {
+        case TileElementType::Banner:
+        case TileElementType::Entrance:
+            return false;
+        case TileElementType::Path:
+            return !element.AsPath()->HasQueueBanner();
+        case TileElementType::SmallScenery:
+        {
+            const auto* entry = element.AsSmallScenery()->GetEntry();
+            return entry == nullptr || !entry->HasFlag(SMALL_SCENERY_FLAG_ANIMATED);
+        }
+        case TileElementType::Wall:
+        {
+            const auto* entry = element.AsWall()->GetEntry();
+            return entry == nullptr
+                || (!(entry->flags2 & WALL_SCENERY_2_ANIMATED) && entry->scrolling_mode == SCROLLING_MODE_NONE);
+        }
+        case TileElementType::LargeScenery:
+        {
+            const auto* entry = element.AsLargeScenery()->GetEntry();
+            return entry == nullptr || entry->scrolling_mode == SCROLLING_MODE_NONE;
+        }
+        case TileElementType::Track:
+        {
+            const auto* trackElement = element.AsTrack();
+            if (trackElement->GetTrackType() == TrackElemType::SpinningTunnel)
+                return false;
+
+            // River rapids and splash boats share their wooden supports across tiles
+            const auto rideType = trackElement->GetRideType();
+            if (rideType == RIDE_TYPE_RIVER_RAPIDS || rideType == RIDE_TYPE_SPLASH_BOATS || rideType == RIDE_TYPE_CHAIRLIFT)
+                return false;
+            return rideType >= RIDE_TYPE_COUNT || !GetRideTypeDescriptor(rideType).HasFlag(RtdFlag::isFlatRide);
+        }
+        default:
+            return true;
+    }
+}
+
+/**
+ * Collects the rides the track of the tile belongs to, returns false if the tile cannot be replayed.
+ */
+static bool GetTileRides(const CoordsXY& mapCoords, std::vector<RideId>& rides)
+{
+    rides.clear();
+    const auto* element = MapGetFirstElementAt(mapCoords);
+    if (element == nullptr)
+        return false;
+
+    do
+    {
+        if (!IsElementReplayable(*element))
+            return false;
+
+        if (element->GetType() == TileElementType::Track)
+        {
+            rides.push_back(element->AsTrack()->GetRideIndex());
+        }
+    } while (!(element++)->IsLastForTile());
+    return true;
+}
+
+static uint64_t GetViewKey(const PaintSession& session)
+{
+    const auto zoom = static_cast<int8_t>(session.DPI.zoom_level);
+    return (static_cast<uint64_t>(session.ViewFlags) << 32) | (static_cast<uint64_t>(session.MayCullImages) << 16)
+        | (static_cast<uint64_t>(zoom & 0xFF) << 8) | static_cast<uint64_t>(session.CurrentRotation & 3);
+}
+
+static bool IsClippedTheSame(const CachedTile& tile, const DrawPixelInfo& dpi)
+{
+    for (const auto& test : tile.ClipTests)
+    {
+        const auto& rect = test.Rect;
+        const bool visible = rect.GetRight() > dpi.x && rect.GetBottom() > dpi.y && rect.GetLeft() < dpi.x + dpi.width
+            && rect.GetTop() < dpi.y + dpi.height;
+        if (visible != test.Visible)
+            return false;
+    }
+    return true;
+}
+
+static const CachedTile* FindTile(
+    const std::unordered_map<uint32_t, CachedTileVariants>& tiles, uint32_t tileIndex, uint64_t viewKey,
+    const DrawPixelInfo& dpi)
+{
+    auto it = tiles.find(tileIndex);
+    if (it == tiles.end())
+        return nullptr;
+
+    for (const auto& tile : it->second)
+    {
+        if (tile->ViewKey == viewKey && IsClippedTheSame(*tile, dpi))
+        {
+            // Only written when it changes, so the sessions sharing the tile do not fight over the line
+            if (tile->LastUsed.load(std::memory_order_relaxed) != _generation)
+            {
+                tile->LastUsed.store(_generation, std::memory_order_relaxed);
+            }
+            return tile.get();
+        }
+    }
+    return nullptr;
+}
+
+template<typename T> static std::optional<uint32_t> FindStructIndex(const std::vector<const T*>& structs, const T* ps)
+{
+    if (ps == nullptr)
+        return kNoStruct;
+
+    auto it = std::find(structs.begin(), structs.end(), ps);
+    if (it == structs.end())
+        return std::nullopt;
+    return static_cast<uint32_t>(it - structs.begin());
+}
+
+/**
+ * Copies what the tile painted into the session, returns nullptr if the session refers to paint structs that are not
+ * part of it.
+ */
+static std::unique_ptr<CachedTile> RecordTile(
+    const PaintSession& session, PaintTileRecording& recording, uint64_t viewKey, const std::vector<RideId>& rides)
+{
+    PROFILED_FUNCTION();
+
+    thread_local std::vector<const PaintStruct*> structs;
+    thread_local std::vector<const AttachedPaintStruct*> attachedStructs;
+    structs.clear();
+    attachedStructs.clear();
+
+    auto tile = std::make_unique<CachedTile>();
+    tile->LastUsed = _generation;
+    tile->ViewKey = viewKey;
+    tile->ClipTests = std::move(recording.ClipTests);
+    tile->CulledImages = std::move(recording.CulledImages);
+    tile->Rides = rides;
+    for (const auto* root : recording.Roots)
+    {
+        uint32_t numChained = 0;
+        for (const auto* ps = root; ps != nullptr; ps = ps->Children)
+        {
+            uint16_t numAttached = 0;
+            for (const auto* attached = ps->Attached; attached != nullptr; attached = attached->NextEntry)
+            {
+                tile->Attached.push_back(*attached);
+                attachedStructs.push_back(attached);
+                numAttached++;
+            }
+
+            tile->Structs.push_back(*ps);
+            tile->NumAttached.push_back(numAttached);
+            structs.push_back(ps);
+            numChained++;
+        }
+        tile->NumChained.push_back(numChained);
+    }
+
+    auto lastPS = FindStructIndex(structs, session.LastPS);
+    auto lastAttachedPS = FindStructIndex(attachedStructs, session.LastAttachedPS);
+    auto woodenSupportsPrependTo = FindStructIndex(structs, session.WoodenSupportsPrependTo);
+    if (!lastPS.has_value() || !lastAttachedPS.has_value() || !woodenSupportsPrependTo.has_value())
+        return nullptr;
+
+    auto& state = tile->ExitState;
+    state.LastPS = *lastPS;
+    state.LastAttachedPS = *lastAttachedPS;
+    state.WoodenSupportsPrependTo = *woodenSupportsPrependTo;
+    state.Surface = session.Surface;
+    state.CurrentlyDrawnTileElement = session.CurrentlyDrawnTileElement;
+    state.PathElementOnSameHeight = session.PathElementOnSameHeight;
+    state.TrackElementOnSameHeight = session.TrackElementOnSameHeight;
+    state.SpritePosition = session.SpritePosition;
+    state.MapPosition = session.MapPosition;
+    state.TrackColours = session.TrackColours;
+    state.SupportColours = session.SupportColours;
+    std::copy(std::begin(session.SupportSegments), std::end(session.SupportSegments), state.SupportSegments.begin());
+    state.Support = session.Support;
+    state.WaterHeight = session.WaterHeight;
+    std::copy(std::begin(session.LeftTunnels), std::end(session.LeftTunnels), state.LeftTunnels.begin());
+    std::copy(std::begin(session.RightTunnels), std::end(session.RightTunnels), state.RightTunnels.begin());
+    state.LeftTunnelCount = session.LeftTunnelCount;
+    state.RightTunnelCount = session.RightTunnelCount;
+    state.VerticalTunnelHeight = session.VerticalTunnelHeight;
+    state.Flags = session.Flags;
+    state.InteractionType = session.InteractionType;
+    state.CullImages = session.CullImages;
+    return tile;
+}
+
+static void ReplayTile(PaintSession& session, const CachedTile& tile)
+{
+    thread_local std::vector<PaintStruct*> structs;
+    thread_local std::vector<AttachedPaintStruct*> attachedStructs;
+    structs.clear();
+    attachedStructs.clear();
+    session.CulledImages.insert(session.CulledImages.end(), tile.CulledImages.begin(), tile.CulledImages.end());
+
+    size_t structIndex = 0;
+    size_t attachedIndex = 0;
+    for (auto numChained : tile.NumChained)
+    {
+        PaintStruct* previous = nullptr;
+        for (uint32_t i = 0; i < numChained; i++, structIndex++)
+        {
+            auto* entry = session.PaintEntryChain.Allocate();
+            if (entry == nullptr)
+                return;
+
+            auto* ps = entry->AsBasic();
+            *ps = tile.Structs[structIndex];
+            ps->Attached = nullptr;
+            ps->Children = nullptr;
+            ps->NextQuadrantEntry = nullptr;
+            if (previous == nullptr)
+            {
+                ps->NextQuadrantEntry = session.Quadrants[ps->QuadrantIndex];
+                session.Quadrants[ps->QuadrantIndex] = ps;
+                session.QuadrantBackIndex = std::min<uint32_t>(session.QuadrantBackIndex, ps->QuadrantIndex);
+                session.QuadrantFrontIndex = std::max<uint32_t>(session.QuadrantFrontIndex, ps->QuadrantIndex);
+            }
+            else
+            {
+                previous->Children = ps;
+            }
+            previous = ps;
+            structs.push_back(ps);
+
+            AttachedPaintStruct* lastAttached = nullptr;
+            for (uint16_t j = 0; j < tile.NumAttached[structIndex]; j++)
+            {
+                auto* attachedEntry = session.PaintEntryChain.Allocate();
+                if (attachedEntry == nullptr)
+                    return;
+
+                auto* attached = attachedEntry->AsAttached();
+                *attached = tile.Attached[attachedIndex++];
+                attached->NextEntry = nullptr;
+                if (lastAttached == nullptr)
+                    ps->Attached = attached;
+                else
+                    lastAttached->NextEntry = attached;
+                lastAttached = attached;
+                attachedStructs.push_back(attached);
+            }
+        }
+    }
+
+    const auto& state = tile.ExitState;
+    session.LastPS = state.LastPS == kNoStruct ? nullptr : structs[state.LastPS];
+    session.LastAttachedPS = state.LastAttachedPS == kNoStruct ? nullptr : attachedStructs[state.LastAttachedPS];
+    session.WoodenSupportsPrependTo = state.WoodenSupportsPrependTo == kNoStruct ? nullptr
+                                                                                 : structs[state.WoodenSupportsPrependTo];
+    session.Surface = state.Surface;
+    session.CurrentlyDrawnTileElement = state.CurrentlyDrawnTileElement;
+    session.PathElementOnSameHeight = state.PathElementOnSameHeight;
+    session.TrackElementOnSameHeight = state.TrackElementOnSameHeight;
+    session.SpritePosition = state.SpritePosition;
+    session.MapPosition = state.MapPosition;
+    session.TrackColours = state.TrackColours;
+    session.SupportColours = state.SupportColours;
+    std::copy(state.SupportSegments.begin(), state.SupportSegments.end(), std::begin(session.SupportSegments));
+    session.Support = state.Support;
+    session.WaterHeight = state.WaterHeight;
+    std::copy(state.LeftTunnels.begin(), state.LeftTunnels.end(), std::begin(session.LeftTunnels));
+    std::copy(state.RightTunnels.begin(), state.RightTunnels.end(), std::begin(session.RightTunnels));
+    session.LeftTunnelCount = state.LeftTunnelCount;
+    session.RightTunnelCount = state.RightTunnelCount;
+    session.VerticalTunnelHeight = state.VerticalTunnelHeight;
+    session.Flags = state.Flags;
+    session.InteractionType = state.InteractionType;
+    session.CullImages = state.CullImages;
+}
+
+void PaintTileCacheSetup(PaintSession& session, const CoordsXY& mapCoords)
+{
+    if (MapIsEdge(mapCoords))
+    {
+        TileElementPaintSetup(session, mapCoords);
+        return;
+    }
+
+    const auto tileIndex = GetTileIndex(TileCoordsXY(mapCoords));
+    const auto viewKey = GetViewKey(session);
+    const auto* tile = FindTile(_tiles, tileIndex, viewKey, session.DPI);
+    if (tile == nullptr)
+    {
+        // Another session may have recorded the tile clipped the same way this frame
+        std::lock_guard<std::mutex> lock(_recordedMutex);
+        tile = FindTile(_recordedTiles, tileIndex, viewKey, session.DPI);
+    }
+    if (tile != nullptr)
+    {
+        ReplayTile(session, *tile);
+        return;
+    }
+
+    thread_local std::vector<RideId> rides;
+    if (!GetTileRides(mapCoords, rides))
+    {
+        TileElementPaintSetup(session, mapCoords);
+        return;
+    }
+
+    // The tile is painted as usual, the recording only keeps what it painted
+    thread_local PaintTileRecording recording;
+    recording.ClipTests.clear();
+    recording.Roots.clear();
+    recording.CulledImages.clear();
+    const auto* lastString = session.LastPSString;
+    session.TileRecording = &recording;
+    TileElementPaintSetup(session, mapCoords);
+    session.TileRecording = nullptr;
+
+    // Text is painted with the current values of its arguments, so tiles with text are not kept
+    if (session.LastPSString != lastString)
+        return;
+
+    auto recorded = RecordTile(session, recording, viewKey, rides);
+    if (recorded == nullptr)
+        return;
+
+    // Sessions clipping the tile the same way paint the same, the tile is kept once per frame
+    std::lock_guard<std::mutex> lock(_recordedMutex);
+    auto& variants = _recordedTiles[tileIndex];
+    if (variants.size() < kMaxTileVariants && FindTile(_recordedTiles, tileIndex, viewKey, session.DPI) == nullptr)
+    {
+        variants.push_back(std::move(recorded));
+        _isCaching.store(true, std::memory_order_relaxed);
+    }
+}
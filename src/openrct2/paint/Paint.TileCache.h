@@ -0,0 +1,43 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+struct PaintSession;
+struct CoordsXY;
+
+/**
+ * Returns whether the paint output of tiles can be reused for the given session. Selections, overlays and other
+ * state that is not tracked by the cache make every tile paint directly.
+ */
+bool PaintTileCacheIsUsable(const PaintSession& session);
+
+/**
+ * Paints the elements of a tile, reusing what it painted in an earlier frame when the tile has not been invalidated
+ * since and every image is clipped the same way. Tiles with animated elements are always painted directly.
+ */
+void PaintTileCacheSetup(PaintSession& session, const CoordsXY& mapCoords);
+
+/**
+ * Hands the tiles recorded since the last update over to the cache, drops the invalidated ones and the ones that have
+ * gone unused the longest. Lookups take no lock, so this must not be called while sessions are being generated.
+ */
+void PaintTileCacheUpdate();
+
+/**
+ * Discards the cached paint of a tile and of its neighbours, which paint from it as well. Called whenever the elements
+ * of the tile change.
+ */
+void PaintTileCacheInvalidateTile(const CoordsXY& mapCoords);
+
+/**
+ * Discards all cached tiles, e.g. after objects have been loaded or the whole map has changed. Tiles paint directly
+ * until the next update.
+ */
+void PaintTileCacheInvalidate();
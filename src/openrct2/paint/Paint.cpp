@@ -23,6 +23,7 @@
 #include "../util/Prefetch.h"
 #include "Boundbox.h"
 #include "Paint.Entity.h"
+#include "Paint.TileCache.h"
 #include "tile_element/Paint.TileElement.h"
 
 #include <algorithm>
@@ -36,6 +37,10 @@ uint8_t gClipHeight = 128; // Default to middle value
 CoordsXY gClipSelectionA = { 0, 0 };
 CoordsXY gClipSelectionB = { MAXIMUM_TILE_START_XY, MAXIMUM_TILE_START_XY };
 
+// Images that cover at most this many pixels are culled, for each zoom level starting at kMinCullingZoomLevel
+static constexpr ZoomLevel kMinCullingZoomLevel{ 2 };
+static constexpr int32_t kMaxCulledImageArea[] = { 1, 2, 4 };
+
 static constexpr uint8_t BoundBoxDebugColours[] = {
     0,   // NONE
     102, // TERRAIN
@@ -96,28 +101,47 @@ static void PaintSessionAddPSToQuadrant(PaintSession& session, PaintStruct* ps)
     ps->QuadrantIndex = paintQuadrantIndex;
     ps->NextQuadrantEntry = session.Quadrants[paintQuadrantIndex];
     session.Quadrants[paintQuadrantIndex] = ps;
+    if (session.TileRecording != nullptr)
+    {
+        session.TileRecording->Roots.push_back(ps);
+    }
 
     session.QuadrantBackIndex = std::min(session.QuadrantBackIndex, paintQuadrantIndex);
     session.QuadrantFrontIndex = std::max(session.QuadrantFrontIndex, paintQuadrantIndex);
 }
 
-static constexpr bool ImageWithinDPI(const ScreenCoordsXY& imagePos, const G1Element& g1, const DrawPixelInfo& dpi)
+bool PaintIsWithinDPI(PaintSession& session, const ScreenRect& rect)
 {
-    int32_t left = imagePos.x + g1.x_offset;
-    int32_t bottom = imagePos.y + g1.y_offset;
+    const auto& dpi = session.DPI;
+    const bool visible = rect.GetRight() > dpi.x && rect.GetBottom() > dpi.y && rect.GetLeft() < dpi.x + dpi.width
+        && rect.GetTop() < dpi.y + dpi.height;
+    if (session.TileRecording != nullptr)
+    {
+        session.TileRecording->ClipTests.push_back({ rect, visible });
+    }
+    return visible;
+}
 
-    int32_t right = left + g1.width;
-    int32_t top = bottom + g1.height;
+static bool ImageWithinDPI(PaintSession& session, const ScreenCoordsXY& imagePos, const G1Element& g1)
+{
+    const int32_t left = imagePos.x + g1.x_offset;
+    const int32_t top = imagePos.y + g1.y_offset;
+    return PaintIsWithinDPI(session, { left, top, left + g1.width, top + g1.height });
+}
 
-    if (right <= dpi.x)
-        return false;
-    if (top <= dpi.y)
-        return false;
-    if (left >= dpi.x + dpi.width)
-        return false;
-    if (bottom >= dpi.y + dpi.height)
-        return false;
-    return true;
+/**
+ * Keeps where an image that is left out would have been, so hit tests there are not answered from this session.
+ */
+static void PaintCullImage(PaintSession& session, const ScreenCoordsXY& imagePos, const G1Element& g1)
+{
+    const int32_t left = imagePos.x + g1.x_offset;
+    const int32_t top = imagePos.y + g1.y_offset;
+    const ScreenRect rect{ left, top, left + g1.width, top + g1.height };
+    session.CulledImages.push_back(rect);
+    if (session.TileRecording != nullptr)
+    {
+        session.TileRecording->CulledImages.push_back(rect);
+    }
 }
 
 static constexpr CoordsXYZ RotateBoundBoxSize(const CoordsXYZ& bbSize, const uint8_t rotation)
@@ -164,11 +188,17 @@ static PaintStruct* CreateNormalPaintStruct(
 
     const auto imagePos = Translate3DTo2DWithZ(session.CurrentRotation, swappedRotCoord);
 
-    if (!ImageWithinDPI(imagePos, *g1, session.DPI))
+    if (!ImageWithinDPI(session, imagePos, *g1))
     {
         return nullptr;
     }
 
+    if (session.CullImages)
+    {
+        PaintCullImage(session, imagePos, *g1);
+        return nullptr;
+    }
+
     const auto rotBoundBoxOffset = CoordsXYZ{ boundBox.offset.Rotate(swappedRotation), boundBox.offset.z };
     const auto rotBoundBoxSize = RotateBoundBoxSize(boundBox.length, session.CurrentRotation);
 
@@ -197,8 +227,18 @@ static PaintStruct* CreateNormalPaintStruct(
     return ps;
 }
 
+static void PaintSessionTileSetup(PaintSession& session, const CoordsXY& mapTile, bool useTileCache)
+{
+    if (useTileCache)
+        PaintTileCacheSetup(session, mapTile);
+    else
+        TileElementPaintSetup(session, mapTile);
+}
+
 template<uint8_t direction> void PaintSessionGenerateRotate(PaintSession& session)
 {
+    const bool useTileCache = PaintTileCacheIsUsable(session);
+
     // Optimised modified version of ViewportPosToMapPos
     ScreenCoordsXY screenCoord = { Floor2(session.DPI.x, 32), Floor2((session.DPI.y - 16), 32) };
     CoordsXY mapTile = { screenCoord.y - screenCoord.x / 2, screenCoord.y + screenCoord.x / 2 };
@@ -222,14 +262,14 @@ template<uint8_t direction> void PaintSessionGenerateRotate(PaintSession& sessio
 
     for (; numVerticalTiles > 0; --numVerticalTiles)
     {
-        TileElementPaintSetup(session, mapTile);
+        PaintSessionTileSetup(session, mapTile, useTileCache);
         EntityPaintSetup(session, mapTile);
 
         const auto loc1 = mapTile + adjacentTiles[0];
         EntityPaintSetup(session, loc1);
 
         const auto loc2 = mapTile + adjacentTiles[1];
-        TileElementPaintSetup(session, loc2);
+        PaintSessionTileSetup(session, loc2, useTileCache);
         EntityPaintSetup(session, loc2);
 
         const auto loc3 = mapTile + adjacentTiles[2];
@@ -811,7 +851,7 @@ PaintStruct* PaintAddImageAsChild(
 bool PaintAttachToPreviousAttach(PaintSession& session, const ImageId imageId, int32_t x, int32_t y)
 {
     auto* previousAttachedPS = session.LastAttachedPS;
-    if (previousAttachedPS == nullptr)
+    if (previousAttachedPS == nullptr || session.CullImages)
     {
         return PaintAttachToPreviousPS(session, imageId, x, y);
     }
@@ -843,7 +883,7 @@ bool PaintAttachToPreviousAttach(PaintSession& session, const ImageId imageId, i
 bool PaintAttachToPreviousPS(PaintSession& session, const ImageId image_id, int32_t x, int32_t y)
 {
     auto* masterPs = session.LastPS;
-    if (masterPs == nullptr)
+    if (masterPs == nullptr || session.CullImages)
     {
         return false;
     }
@@ -901,6 +941,23 @@ void PaintFloatingMoneyEffect(
     ps->ScreenPos = ScreenCoordsXY{ coord.x + offset_x, coord.y };
 }
 
+bool PaintIsImageTooSmall(const PaintSession& session, const ImageId imageId)
+{
+    const auto zoom = session.DPI.zoom_level;
+    if (zoom < kMinCullingZoomLevel || !session.MayCullImages)
+        return false;
+
+    const auto* g1 = GfxGetG1Element(imageId);
+    if (g1 == nullptr)
+        return false;
+
+    const auto width = zoom.ApplyInversedTo(g1->width);
+    const auto height = zoom.ApplyInversedTo(g1->height);
+    const auto level = std::min<size_t>(
+        static_cast<int8_t>(zoom) - static_cast<int8_t>(kMinCullingZoomLevel), std::size(kMaxCulledImageArea) - 1);
+    return width * height <= kMaxCulledImageArea[level];
+}
+
 /**
  *
  *  rct2: 0x006860C3
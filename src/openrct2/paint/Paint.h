@@ -18,6 +18,7 @@
 
 #include <mutex>
 #include <thread>
+#include <vector>
 
 struct EntityBase;
 struct TileElement;
@@ -204,12 +205,39 @@ struct PaintSessionCore
     uint8_t CurrentRotation;
     uint8_t Flags;
     ViewportInteractionItem InteractionType;
+    // Images that are too small to see may be left out, only set for sessions that are drawn
+    bool MayCullImages;
+    // Leaves out the images that are added, see PaintIsImageTooSmall
+    bool CullImages;
+};
+
+/**
+ * Whether an image or a tile was found within the DPI of a session.
+ */
+struct PaintClipTest
+{
+    ScreenRect Rect;
+    bool Visible;
+};
+
+/**
+ * What a tile painted and every clip test it took, kept by the tile cache while the tile is painted.
+ */
+struct PaintTileRecording
+{
+    std::vector<PaintClipTest> ClipTests;
+    // Paint structs in the order they were added to their quadrants
+    std::vector<PaintStruct*> Roots;
+    std::vector<ScreenRect> CulledImages;
 };
 
 struct PaintSession : public PaintSessionCore
 {
     DrawPixelInfo DPI;
     PaintEntryPool::Chain PaintEntryChain;
+    PaintTileRecording* TileRecording;
+    // Where the images left out by culling would have been, hit tests there have to paint without culling
+    std::vector<ScreenRect> CulledImages;
 
     PaintStruct* AllocateNormalPaintEntry() noexcept
     {
@@ -330,9 +358,21 @@ void PaintFloatingMoneyEffect(
     PaintSession& session, money64 amount, StringId string_id, int32_t y, int32_t z, int8_t y_offsets[], int32_t offset_x,
     uint32_t rotation);
 
+/**
+ * Returns whether an image would cover no more than a pixel or two at the zoom level of the session, so that it does not
+ * need to be painted. Always false for sessions that may not cull images.
+ */
+bool PaintIsImageTooSmall(const PaintSession& session, const ImageId imageId);
+
+/**
+ * Returns whether the screen rectangle is within the DPI of the session, the result is kept when the tile cache records.
+ */
+bool PaintIsWithinDPI(PaintSession& session, const ScreenRect& rect);
+
 PaintSession* PaintSessionAlloc(DrawPixelInfo& dpi, uint32_t viewFlags, uint8_t rotation);
 void PaintSessionFree(PaintSession* session);
 void PaintSessionGenerate(PaintSession& session);
 void PaintSessionArrange(PaintSessionCore& session);
+
 void PaintDrawStructs(PaintSession& session);
 void PaintDrawMoneyStructs(DrawPixelInfo& dpi, PaintStringStruct* ps);
@@ -176,6 +176,8 @@ PaintSession* Painter::CreateSession(DrawPixelInfo& dpi, uint32_t viewFlags, uin
     session->QuadrantFrontIndex = 0;
     session->PaintEntryChain = _paintStructPool.Create();
     session->Flags = 0;
+    session->MayCullImages = false;
+    session->CullImages = false;
     session->CurrentRotation = rotation;
 
     std::fill(std::begin(session->Quadrants), std::end(session->Quadrants), nullptr);
@@ -188,6 +190,8 @@ PaintSession* Painter::CreateSession(DrawPixelInfo& dpi, uint32_t viewFlags, uin
     session->CurrentlyDrawnEntity = nullptr;
     session->CurrentlyDrawnTileElement = nullptr;
     session->Surface = nullptr;
+    session->TileRecording = nullptr;
+    session->CulledImages.clear();
     session->SelectedElement = OpenRCT2::TileInspector::GetSelectedElement();
 
     return session;
@@ -221,6 +221,16 @@ inline bool PathAdditionIsVisible(uint32_t viewFlags, const PathAdditionEntry& p
     return false;
 }
 
+static bool PathAdditionIsTooSmall(
+    const PaintSession& session, const PathAdditionEntry& pathAdditionEntry, ImageId imageTemplate)
+{
+    // Selected and ghost additions are always shown
+    if (imageTemplate.IsRemap())
+        return false;
+
+    return PaintIsImageTooSmall(session, ImageId(pathAdditionEntry.image + 1));
+}
+
 void Sub6A3F61PathAddition(PaintSession& session, const PathElement& pathElement, uint16_t height, ImageId sceneryImageTemplate)
 {
     // Path additions get drawn on edges that are not connected, so we need to flip them.
@@ -240,6 +250,7 @@ void Sub6A3F61PathAddition(PaintSession& session, const PathElement& pathElement
         return;
     }
 
+    session.CullImages = PathAdditionIsTooSmall(session, *pathAddEntry, sceneryImageTemplate);
     switch (pathAddEntry->draw_type)
     {
         case PathAdditionDrawType::Light:
@@ -255,6 +266,7 @@ void Sub6A3F61PathAddition(PaintSession& session, const PathElement& pathElement
             PathAdditionJumpingFountainsPaint(session, *pathAddEntry, height, sceneryImageTemplate, session.DPI);
             break;
     }
+    session.CullImages = false;
 
     session.InteractionType = ViewportInteractionItem::Footpath;
 
@@ -189,6 +189,11 @@ static void PaintSmallSceneryBody(
             baseImageIndex += 4;
         }
     }
+
+    // Selected and ghost scenery is always shown
+    session.CullImages = !sceneryEntry->HasFlag(SMALL_SCENERY_FLAG_VISIBLE_WHEN_ZOOMED) && !imageTemplate.IsRemap()
+        && PaintIsImageTooSmall(session, ImageId(baseImageIndex));
+
     if (!(sceneryEntry->HasFlag(SMALL_SCENERY_FLAG_VISIBLE_WHEN_ZOOMED)))
     {
         auto imageId = imageTemplate.WithIndex(baseImageIndex);
@@ -364,6 +369,7 @@ void PaintSmallScenery(PaintSession& session, uint8_t direction, int32_t height,
     }
 
     PaintSmallSceneryBody(session, direction, height, sceneryElement, sceneryEntry, imageTemplate);
+    session.CullImages = false;
     PaintSmallScenerySupports(session, *sceneryEntry, sceneryElement, direction, height, imageTemplate);
     SetSupportHeights(session, *sceneryEntry, sceneryElement, height);
 }
@@ -33,6 +33,8 @@
 #include "Paint.Surface.h"
 #include "Segment.h"
 
+#include <limits>
+
 using namespace OpenRCT2;
 
 static void BlankTilesPaint(PaintSession& session, int32_t x, int32_t y);
@@ -46,6 +48,13 @@ void TileElementPaintSetup(PaintSession& session, const CoordsXY& mapCoords, boo
 {
     PROFILED_FUNCTION();
 
+    // Nothing painted for a tile attaches to what was painted before it
+    session.LastPS = nullptr;
+    session.LastAttachedPS = nullptr;
+    session.WoodenSupportsPrependTo = nullptr;
+    session.PathElementOnSameHeight = nullptr;
+    session.TrackElementOnSameHeight = nullptr;
+
     if (!MapIsEdge(mapCoords))
     {
         PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -179,7 +188,9 @@ static void PaintTileElementBase(PaintSession& session, const CoordsXY& origCoor
         PaintAddImageAsParent(session, imageId, { 0, 0, arrowZ }, { { 0, 0, arrowZ + 18 }, { 32, 32, -1 } });
     }
 
-    if (screenMinY + 52 <= session.DPI.y)
+    constexpr auto kMinScreen = std::numeric_limits<int32_t>::min();
+    constexpr auto kMaxScreen = std::numeric_limits<int32_t>::max();
+    if (!PaintIsWithinDPI(session, { kMinScreen, kMinScreen, kMaxScreen, screenMinY + 52 }))
         return;
 
     const TileElement* element = tile_element; // push tile_element
@@ -203,7 +214,7 @@ static void PaintTileElementBase(PaintSession& session, const CoordsXY& origCoor
         max_height = std::max(max_height, VirtualFloorGetHeight());
     }
 
-    if (screenMinY - (max_height + 32) >= session.DPI.y + session.DPI.height)
+    if (!PaintIsWithinDPI(session, { kMinScreen, screenMinY - (max_height + 32), kMaxScreen, kMaxScreen }))
         return;
 
     session.SpritePosition.x = coords.x;
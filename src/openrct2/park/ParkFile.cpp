@@ -21,6 +21,7 @@
 #include "../core/Crypt.h"
 #include "../core/DataSerialiser.h"
 #include "../core/File.h"
+#include "../core/MemoryMappedFile.h"
 #include "../core/OrcaStream.hpp"
 #include "../core/Path.hpp"
 #include "../drawing/Drawing.h"
@@ -60,6 +61,7 @@
 #include <cassert>
 #include <cstdint>
 #include <ctime>
+#include <future>
 #include <numeric>
 #include <optional>
 #include <string_view>
@@ -105,11 +107,39 @@ namespace OpenRCT2
         bool OmitTracklessRides{};
 
     private:
+        std::unique_ptr<MemoryMappedFile> _mappedFile;
+        std::unique_ptr<MemoryStream> _mappedStream;
         std::unique_ptr<OrcaStream> _os;
         ObjectEntryIndex _pathToSurfaceMap[kMaxPathObjects];
         ObjectEntryIndex _pathToQueueSurfaceMap[kMaxPathObjects];
         ObjectEntryIndex _pathToRailingsMap[kMaxPathObjects];
 
+        void WriteChunks(GameState_t& gameState, OrcaStream& os)
+        {
+            auto& header = os.GetHeader();
+            header.Magic = PARK_FILE_MAGIC;
+            header.TargetVersion = PARK_FILE_CURRENT_VERSION;
+            header.MinVersion = PARK_FILE_MIN_VERSION;
+
+            ReadWriteAuthoringChunk(os);
+            ReadWriteObjectsChunk(os);
+            ReadWriteTilesChunk(gameState, os);
+            ReadWriteBannersChunk(gameState, os);
+            ReadWriteRidesChunk(gameState, os);
+            ReadWriteEntitiesChunk(gameState, os);
+            ReadWriteScenarioChunk(gameState, os);
+            ReadWriteGeneralChunk(gameState, os);
+            ReadWriteParkChunk(gameState, os);
+            ReadWriteClimateChunk(gameState, os);
+            ReadWriteResearchChunk(gameState, os);
+            ReadWriteNotificationsChunk(gameState, os);
+            ReadWriteInterfaceChunk(gameState, os);
+            ReadWriteCheatsChunk(gameState, os);
+            ReadWriteRestrictedObjectsChunk(gameState, os);
+            ReadWritePluginStorageChunk(gameState, os);
+            ReadWritePackedObjectsChunk(os);
+        }
+
         void ThrowIfIncompatibleVersion()
         {
             const auto& header = _os->GetHeader();
@@ -128,15 +158,45 @@ namespace OpenRCT2
             return targetVersion > PARK_FILE_CURRENT_VERSION;
         }
 
+        /**
+         * Only the chunks needed for the object list are inflated, the remaining chunks are inflated when they are
+         * read or on Import. The file stays mapped until the ParkFile is destroyed.
+         */
         void Load(const std::string_view path)
         {
-            FileStream fs(path, FILE_MODE_OPEN);
-            Load(fs);
+            OpenMapped(path);
+            LoadObjectList();
         }
 
         void Load(IStream& stream)
         {
             _os = std::make_unique<OrcaStream>(stream, OrcaStream::Mode::READING);
+            LoadObjectList();
+        }
+
+        /**
+         * Opens the park without reading the object chunks, only the chunks read afterwards get inflated.
+         */
+        void LoadHeader(const std::string_view path)
+        {
+            OpenMapped(path);
+            ThrowIfIncompatibleVersion();
+        }
+
+    private:
+        /**
+         * Chunks are inflated straight from the mapped pages, so only the pages of chunks that are read get loaded.
+         * Files without a chunk index are still inflated as a whole.
+         */
+        void OpenMapped(const std::string_view path)
+        {
+            _mappedFile = std::make_unique<MemoryMappedFile>(path);
+            _mappedStream = std::make_unique<MemoryStream>(_mappedFile->GetData(), _mappedFile->GetLength());
+            _os = std::make_unique<OrcaStream>(*_mappedStream, OrcaStream::Mode::READING, true);
+        }
+
+        void LoadObjectList()
+        {
             ThrowIfIncompatibleVersion();
 
             RequiredObjects = {};
@@ -144,9 +204,11 @@ namespace OpenRCT2
             ReadWritePackedObjectsChunk(*_os);
         }
 
+    public:
         void Import(GameState_t& gameState)
         {
             auto& os = *_os;
+            os.DecompressAllChunks();
             ReadWriteTilesChunk(gameState, os);
             ReadWriteBannersChunk(gameState, os);
             ReadWriteRidesChunk(gameState, os);
@@ -173,29 +235,7 @@ namespace OpenRCT2
         void Save(GameState_t& gameState, IStream& stream)
         {
             OrcaStream os(stream, OrcaStream::Mode::WRITING);
-
-            auto& header = os.GetHeader();
-            header.Magic = PARK_FILE_MAGIC;
-            header.TargetVersion = PARK_FILE_CURRENT_VERSION;
-            header.MinVersion = PARK_FILE_MIN_VERSION;
-
-            ReadWriteAuthoringChunk(os);
-            ReadWriteObjectsChunk(os);
-            ReadWriteTilesChunk(gameState, os);
-            ReadWriteBannersChunk(gameState, os);
-            ReadWriteRidesChunk(gameState, os);
-            ReadWriteEntitiesChunk(gameState, os);
-            ReadWriteScenarioChunk(gameState, os);
-            ReadWriteGeneralChunk(gameState, os);
-            ReadWriteParkChunk(gameState, os);
-            ReadWriteClimateChunk(gameState, os);
-            ReadWriteResearchChunk(gameState, os);
-            ReadWriteNotificationsChunk(gameState, os);
-            ReadWriteInterfaceChunk(gameState, os);
-            ReadWriteCheatsChunk(gameState, os);
-            ReadWriteRestrictedObjectsChunk(gameState, os);
-            ReadWritePluginStorageChunk(gameState, os);
-            ReadWritePackedObjectsChunk(os);
+            WriteChunks(gameState, os);
         }
 
         void Save(GameState_t& gameState, const std::string_view path)
@@ -204,6 +244,16 @@ namespace OpenRCT2
             Save(gameState, fs);
         }
 
+        /**
+         * Serialises all chunks without compressing or writing them.
+         */
+        OrcaStream::Image SaveToImage(GameState_t& gameState)
+        {
+            OrcaStream os;
+            WriteChunks(gameState, os);
+            return os.TakeImage();
+        }
+
         ScenarioIndexEntry ReadScenarioChunk()
         {
             ScenarioIndexEntry entry{};
@@ -2537,7 +2587,10 @@ enum : uint32_t
     S6_SAVE_FLAG_AUTOMATIC = 1u << 31,
 };
 
-int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
+/**
+ * Prepares the map and serialises the park at the current tick, shared by blocking and background saves.
+ */
+static OrcaStream::Image ScenarioSerialise(GameState_t& gameState, int32_t flags)
 {
     if (flags & S6_SAVE_FLAG_SCENARIO)
     {
@@ -2556,39 +2609,65 @@ int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
 
     PrepareMapForSave();
 
-    bool result = false;
     auto parkFile = std::make_unique<OpenRCT2::ParkFile>();
+    if (flags & S6_SAVE_FLAG_EXPORT)
+    {
+        auto& objManager = OpenRCT2::GetContext()->GetObjectManager();
+        parkFile->ExportObjectsList = objManager.GetPackableObjects();
+    }
+    parkFile->OmitTracklessRides = true;
+    return parkFile->SaveToImage(gameState);
+}
+
+/**
+ * Compresses and writes a serialised park. The file is written under a temporary name and renamed once complete,
+ * so a partially written save is never left at path. Does not touch any game state, so it can run on any thread.
+ */
+static void ScenarioWriteImage(OrcaStream::Image& image, const u8string& path)
+{
+    const auto tempPath = path + u8".tmp";
     try
     {
-        if (flags & S6_SAVE_FLAG_EXPORT)
         {
-            auto& objManager = OpenRCT2::GetContext()->GetObjectManager();
-            parkFile->ExportObjectsList = objManager.GetPackableObjects();
+            FileStream fs(tempPath, FILE_MODE_WRITE);
+            image.Write(fs);
         }
-        parkFile->OmitTracklessRides = true;
-        if (flags & S6_SAVE_FLAG_SCENARIO)
-        {
-            // s6exporter->SaveScenario(path);
-        }
-        else
+        if (!File::Move(tempPath, path))
         {
-            // s6exporter->SaveGame(path);
+            throw IOException("Unable to move '" + tempPath + "' to '" + path + "'");
         }
-        parkFile->Save(gameState, path);
-        result = true;
     }
-    catch (const std::exception& e)
+    catch (const std::exception&)
     {
-        LOG_ERROR(e.what());
+        File::Delete(tempPath);
+        throw;
+    }
+}
 
-        Formatter ft;
-        ft.Add<const char*>(e.what());
-        ContextShowError(STR_FILE_DIALOG_TITLE_SAVE_SCENARIO, STR_STRING, ft);
-        GfxInvalidateScreen();
+/**
+ * Reports the outcome of a save on the game thread, returns whether it succeeded.
+ */
+static bool ScenarioFinishSave(int32_t flags, const std::exception_ptr& error)
+{
+    if (error != nullptr)
+    {
+        try
+        {
+            std::rethrow_exception(error);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR(e.what());
+
+            Formatter ft;
+            ft.Add<const char*>(e.what());
+            ContextShowError(STR_FILE_DIALOG_TITLE_SAVE_SCENARIO, STR_STRING, ft);
+        }
     }
 
     GfxInvalidateScreen();
 
+    const auto result = error == nullptr;
     if (result && !(flags & S6_SAVE_FLAG_AUTOMATIC))
     {
         gScreenAge = 0;
@@ -2596,6 +2675,109 @@ int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
     return result;
 }
 
+int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
+{
+    std::exception_ptr error;
+    try
+    {
+        auto image = ScenarioSerialise(gameState, flags);
+        ScenarioWriteImage(image, u8string(path));
+    }
+    catch (const std::exception&)
+    {
+        error = std::current_exception();
+    }
+    return ScenarioFinishSave(flags, error);
+}
+
+struct PendingScenarioSave
+{
+    std::future<void> Result;
+    int32_t Flags;
+    std::function<void(bool)> Callback;
+};
+
+static std::vector<PendingScenarioSave> _pendingScenarioSaves;
+
+/**
+ * Serialises the park at the current tick, then compresses and writes it on a background thread.
+ * The callback is invoked on the game thread by ScenarioUpdatePendingSaves or ScenarioFlushPendingSaves.
+ */
+void ScenarioSaveAsync(GameState_t& gameState, u8string_view path, int32_t flags, std::function<void(bool)> callback)
+{
+    OrcaStream::Image image;
+    try
+    {
+        image = ScenarioSerialise(gameState, flags);
+    }
+    catch (const std::exception&)
+    {
+        const auto result = ScenarioFinishSave(flags, std::current_exception());
+        if (callback != nullptr)
+        {
+            callback(result);
+        }
+        return;
+    }
+
+    auto result = std::async(
+        std::launch::async,
+        [image = std::move(image), targetPath = u8string(path)]() mutable { ScenarioWriteImage(image, targetPath); });
+    _pendingScenarioSaves.push_back({ std::move(result), flags, std::move(callback) });
+}
+
+static void ScenarioCompletePendingSave(PendingScenarioSave& pending)
+{
+    std::exception_ptr error;
+    try
+    {
+        pending.Result.get();
+    }
+    catch (const std::exception&)
+    {
+        error = std::current_exception();
+    }
+
+    const auto result = ScenarioFinishSave(pending.Flags, error);
+    if (pending.Callback != nullptr)
+    {
+        pending.Callback(result);
+    }
+}
+
+/**
+ * Completes the background saves that have finished, called once per frame from the main loop.
+ */
+void ScenarioUpdatePendingSaves()
+{
+    auto it = _pendingScenarioSaves.begin();
+    while (it != _pendingScenarioSaves.end())
+    {
+        if (it->Result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            it++;
+            continue;
+        }
+
+        auto pending = std::move(*it);
+        it = _pendingScenarioSaves.erase(it);
+        ScenarioCompletePendingSave(pending);
+    }
+}
+
+/**
+ * Waits for all background saves and completes them, so none is cut off when the context shuts down.
+ */
+void ScenarioFlushPendingSaves()
+{
+    auto pendingSaves = std::move(_pendingScenarioSaves);
+    _pendingScenarioSaves.clear();
+    for (auto& pending : pendingSaves)
+    {
+        ScenarioCompletePendingSave(pending);
+    }
+}
+
 class ParkFileImporter final : public IParkImporter
 {
 private:
@@ -2642,6 +2824,12 @@ public:
         return result;
     }
 
+    void LoadScenarioDetails(const u8string& path) override
+    {
+        _parkFile = std::make_unique<OpenRCT2::ParkFile>();
+        _parkFile->LoadHeader(path);
+    }
+
     void Import(GameState_t& gameState) override
     {
         _parkFile->Import(gameState);
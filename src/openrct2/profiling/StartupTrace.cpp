@@ -0,0 +1,135 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "StartupTrace.h"
+
+#include "../Diagnostic.h"
+#include "../core/Json.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace OpenRCT2::StartupTrace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Event
+    {
+        std::string Name;
+        int64_t Start{};
+        int64_t Duration{};
+        uint32_t ThreadIndex{};
+    };
+
+    // Initialised during static initialisation, which is as close to process start as we can get.
+    static const Clock::time_point _origin = Clock::now();
+
+    static std::mutex _mutex;
+    static std::vector<Event> _events;
+    static u8string _outputPath;
+    static bool _finished{};
+    static std::atomic<uint32_t> _nextThreadIndex{ 0 };
+
+    static int64_t ToMicroseconds(Clock::duration duration)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    }
+
+    static uint32_t GetThreadIndex()
+    {
+        thread_local const uint32_t threadIndex = _nextThreadIndex++;
+        return threadIndex;
+    }
+
+    Scope::Scope(std::string_view name)
+        : _name(name)
+        , _start(Clock::now())
+    {
+    }
+
+    Scope::~Scope()
+    {
+        const auto end = Clock::now();
+        const auto threadIndex = GetThreadIndex();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_finished)
+            return;
+
+        _events.push_back(
+            { std::move(_name), ToMicroseconds(_start - _origin), ToMicroseconds(end - _start), threadIndex });
+    }
+
+    void SetOutputPath(u8string_view path)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _outputPath = path;
+    }
+
+    static void WriteJson(const u8string& path, const std::vector<Event>& events)
+    {
+        auto traceEvents = json_t::array();
+        for (const auto& event : events)
+        {
+            traceEvents.push_back({
+                { "name", event.Name },
+                { "ph", "X" },
+                { "ts", event.Start },
+                { "dur", event.Duration },
+                { "pid", 0 },
+                { "tid", event.ThreadIndex },
+            });
+        }
+
+        json_t root = { { "traceEvents", std::move(traceEvents) }, { "displayTimeUnit", "ms" } };
+        Json::WriteToFile(path, root, 0);
+    }
+
+    void Finish()
+    {
+        std::vector<Event> events;
+        u8string outputPath;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_finished)
+                return;
+
+            _finished = true;
+            events = std::move(_events);
+            outputPath = std::move(_outputPath);
+        }
+
+        std::stable_sort(events.begin(), events.end(), [](const Event& a, const Event& b) { return a.Start < b.Start; });
+
+        const auto totalTime = ToMicroseconds(Clock::now() - _origin);
+        LOG_VERBOSE("Startup finished after %.1f ms", totalTime / 1000.0);
+        for (const auto& event : events)
+        {
+            LOG_VERBOSE(
+                "  %9.1f ms %9.1f ms  [thread %u] %s", event.Start / 1000.0, event.Duration / 1000.0, event.ThreadIndex,
+                event.Name.c_str());
+        }
+
+        if (!outputPath.empty())
+        {
+            try
+            {
+                WriteJson(outputPath, events);
+                LOG_VERBOSE("Startup trace written to %s", outputPath.c_str());
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR("Unable to write startup trace to %s: %s", outputPath.c_str(), e.what());
+            }
+        }
+    }
+} // namespace OpenRCT2::StartupTrace
@@ -0,0 +1,48 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../core/String.hpp"
+
+#include <chrono>
+#include <string>
+#include <string_view>
+
+namespace OpenRCT2::StartupTrace
+{
+    /**
+     * Records the time spent in a startup stage, from construction until destruction.
+     * Scopes may be nested and may be used from any thread.
+     */
+    class Scope
+    {
+    private:
+        std::string _name;
+        std::chrono::steady_clock::time_point _start;
+
+    public:
+        explicit Scope(std::string_view name);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    /**
+     * Sets the file the trace is written to when startup finishes, in the Chrome trace event format.
+     */
+    void SetOutputPath(u8string_view path);
+
+    /**
+     * Marks the end of startup. The recorded stages are logged as verbose messages and written to the output path
+     * if one is set. Only the first call has an effect.
+     */
+    void Finish();
+} // namespace OpenRCT2::StartupTrace
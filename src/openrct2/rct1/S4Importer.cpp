@@ -161,6 +161,16 @@ namespace OpenRCT2::RCT1
             return result;
         }
 
+        void LoadScenarioDetails(const u8string& path) override
+        {
+            // The park is stored as a single encoded block, so all of it has to be decoded.
+            auto fs = FileStream(path, FILE_MODE_OPEN);
+            _s4 = *ReadAndDecodeS4(&fs, true);
+            _s4Path = path;
+            _isScenario = true;
+            _gameVersion = SawyerCodingDetectRCT1Version(_s4.GameVersion) & FILE_VERSION_MASK;
+        }
+
         ParkLoadResult LoadFromStream(
             IStream* stream, bool isScenario, [[maybe_unused]] bool skipObjectCheck, const u8string& path) override
         {
@@ -142,37 +142,21 @@ namespace OpenRCT2::RCT2
             return result;
         }
 
+        void LoadScenarioDetails(const u8string& path) override
+        {
+            auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
+            auto chunkReader = SawyerChunkReader(&fs);
+            ReadHeaderChunks(chunkReader, true);
+            _isScenario = true;
+            _s6Path = path;
+        }
+
         ParkLoadResult LoadFromStream(
             OpenRCT2::IStream* stream, bool isScenario, [[maybe_unused]] bool skipObjectCheck = false,
             const u8string& path = {}) override
         {
             auto chunkReader = SawyerChunkReader(stream);
-            chunkReader.ReadChunk(&_s6.Header, sizeof(_s6.Header));
-
-            LOG_VERBOSE("saved game classic_flag = 0x%02x", _s6.Header.ClassicFlag);
-            if (isScenario)
-            {
-                if (_s6.Header.Type != S6_TYPE_SCENARIO)
-                {
-                    throw std::runtime_error("Park is not a scenario.");
-                }
-                chunkReader.ReadChunk(&_s6.Info, sizeof(_s6.Info));
-
-                // If the name or the details contain a colour code, they might be in UTF-8 already.
-                // This is caused by a bug that was in OpenRCT2 for 3 years.
-                if (!IsLikelyUTF8(_s6.Info.Name) && !IsLikelyUTF8(_s6.Info.Details))
-                {
-                    RCT2StringToUTF8Self(_s6.Info.Name, sizeof(_s6.Info.Name));
-                    RCT2StringToUTF8Self(_s6.Info.Details, sizeof(_s6.Info.Details));
-                }
-            }
-            else
-            {
-                if (_s6.Header.Type != S6_TYPE_SAVEDGAME)
-                {
-                    throw std::runtime_error("Park is not a saved game.");
-                }
-            }
+            ReadHeaderChunks(chunkReader, isScenario);
 
             // Read packed objects
             // TODO try to contain this more and not store objects until later
@@ -215,6 +199,39 @@ namespace OpenRCT2::RCT2
             return ParkLoadResult(GetRequiredObjects());
         }
 
+        /**
+         * Reads the header chunk and, for scenarios, the scenario info chunk.
+         */
+        void ReadHeaderChunks(SawyerChunkReader& chunkReader, bool isScenario)
+        {
+            chunkReader.ReadChunk(&_s6.Header, sizeof(_s6.Header));
+
+            LOG_VERBOSE("saved game classic_flag = 0x%02x", _s6.Header.ClassicFlag);
+            if (isScenario)
+            {
+                if (_s6.Header.Type != S6_TYPE_SCENARIO)
+                {
+                    throw std::runtime_error("Park is not a scenario.");
+                }
+                chunkReader.ReadChunk(&_s6.Info, sizeof(_s6.Info));
+
+                // If the name or the details contain a colour code, they might be in UTF-8 already.
+                // This is caused by a bug that was in OpenRCT2 for 3 years.
+                if (!IsLikelyUTF8(_s6.Info.Name) && !IsLikelyUTF8(_s6.Info.Details))
+                {
+                    RCT2StringToUTF8Self(_s6.Info.Name, sizeof(_s6.Info.Name));
+                    RCT2StringToUTF8Self(_s6.Info.Details, sizeof(_s6.Info.Details));
+                }
+            }
+            else
+            {
+                if (_s6.Header.Type != S6_TYPE_SAVEDGAME)
+                {
+                    throw std::runtime_error("Park is not a saved game.");
+                }
+            }
+        }
+
         void ReadChunk6(SawyerChunkReader& chunkReader, uint32_t sizeWithoutEntities)
         {
             uint32_t entitiesSize = GetMaxEntities() * sizeof(Entity);
@@ -387,6 +387,7 @@ void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
     else
     {
         queueHeadGuest->GuestNextInQueue = peep->Id;
+        EntityInvalidateChecksum(queueHeadGuest);
     }
     UpdateQueueLength(peep->CurrentRideStation);
 }
@@ -565,6 +565,7 @@ uint16_t Vehicle::GetTrackProgress() const
 
 void Vehicle::ApplyMass(int16_t appliedMass)
 {
+    EntityInvalidateChecksum(this);
     mass = std::clamp<int32_t>(mass + appliedMass, 1, std::numeric_limits<decltype(mass)>::max());
 }
 
@@ -604,6 +605,11 @@ void VehicleUpdateAll()
 
     for (auto vehicle : TrainManager::View())
     {
+        // The update of a train moves and accelerates all of its cars
+        for (const Vehicle* car = vehicle; car != nullptr; car = GetEntity<Vehicle>(car->next_vehicle_on_train))
+        {
+            EntityInvalidateChecksum(car);
+        }
         vehicle->Update();
     }
 }
@@ -5243,6 +5249,7 @@ int32_t Vehicle::UpdateMotionDodgems()
                 if (oldVelocity >= 2.0_mph)
                 {
                     collideVehicle->DodgemsCollisionDirection = direction;
+                    EntityInvalidateChecksum(collideVehicle);
                     DodgemsCollisionDirection = direction ^ (1 << 4);
                 }
             }
@@ -6725,6 +6732,8 @@ void Vehicle::ReverseReverserCar()
 
     previousVehicle->track_progress = 86;
     nextVehicle->track_progress = 158;
+    EntityInvalidateChecksum(previousVehicle);
+    EntityInvalidateChecksum(nextVehicle);
 
     nextVehicle->UpdateReverserCarBogies();
     previousVehicle->UpdateReverserCarBogies();
@@ -8162,6 +8171,7 @@ Loc6DCA9A:
                     }
                     vEDI->velocity = vEBP->velocity >> 1;
                     vEBP->velocity = vEDI->velocity >> 1;
+                    EntityInvalidateChecksum(vEBP);
                 }
                 _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
                 if (remaining_distance < 0x368A)
@@ -8951,6 +8961,7 @@ Vehicle* Vehicle::GetCar(size_t carIndex) const
 
 void Vehicle::SetState(Vehicle::Status vehicleStatus, uint8_t subState)
 {
+    EntityInvalidateChecksum(this);
     status = vehicleStatus;
     sub_state = subState;
     InvalidateWindow();
@@ -12,6 +12,7 @@
 #include "../Identifiers.h"
 #include "../audio/audio.h"
 #include "../entity/EntityBase.h"
+#include "../entity/EntityRegistry.h"
 #include "../ride/RideTypes.h"
 #include "../world/Location.hpp"
 #include "CarEntry.h"
@@ -265,10 +266,12 @@ struct Vehicle : EntityBase
     void ClearFlag(uint32_t flag)
     {
         Flags &= ~flag;
+        EntityInvalidateChecksum(this);
     }
     void SetFlag(uint32_t flag)
     {
         Flags |= flag;
+        EntityInvalidateChecksum(this);
     }
     void ApplyMass(int16_t appliedMass);
     void Serialise(DataSerialiser& stream);
@@ -20,6 +20,8 @@
 #include "../world/Map.h"
 #include "../world/MapAnimation.h"
 
+#include <functional>
+
 struct ResultWithMessage;
 
 using random_engine_t = OpenRCT2::Random::RCT2::Engine;
@@ -175,6 +177,10 @@ uint32_t ScenarioRandMax(uint32_t max);
 
 ResultWithMessage ScenarioPrepareForSave(OpenRCT2::GameState_t& gameState);
 int32_t ScenarioSave(OpenRCT2::GameState_t& gameState, u8string_view path, int32_t flags);
+void ScenarioSaveAsync(
+    OpenRCT2::GameState_t& gameState, u8string_view path, int32_t flags, std::function<void(bool)> callback = nullptr);
+void ScenarioUpdatePendingSaves();
+void ScenarioFlushPendingSaves();
 void ScenarioFailure(OpenRCT2::GameState_t& gameState);
 void ScenarioSuccess(OpenRCT2::GameState_t& gameState);
 void ScenarioSuccessSubmitName(OpenRCT2::GameState_t& gameState, const char* name);
@@ -32,7 +32,11 @@
 #include "Scenario.h"
 #include "ScenarioSources.h"
 
+#include <chrono>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -217,7 +221,7 @@ private:
 
             if (importer)
             {
-                importer->LoadScenario(path, true);
+                importer->LoadScenarioDetails(path);
                 if (importer->GetDetails(entry))
                 {
                     entry->Path = path;
@@ -246,6 +250,14 @@ private:
     ScenarioFileIndex const _fileIndex;
     std::vector<ScenarioIndexEntry> _scenarios;
     std::vector<ScenarioHighscoreEntry*> _highscores;
+    std::future<std::vector<ScenarioIndexEntry>> _backgroundScan;
+
+    // Highscores are written on a background thread. Records made while a write is in progress are batched into
+    // the next write, which always contains the latest snapshot.
+    std::mutex _highscoreSaveMutex;
+    std::optional<std::vector<ScenarioHighscoreEntry>> _pendingHighscores;
+    std::future<void> _highscoreSave;
+    bool _highscoreSaveRunning{};
 
 public:
     explicit ScenarioRepository(const std::shared_ptr<IPlatformEnvironment>& env)
@@ -256,26 +268,60 @@ public:
 
     virtual ~ScenarioRepository()
     {
+        WaitForBackgroundScan();
+        WaitForHighscoreSave();
         ClearHighscores();
     }
 
     void Scan(int32_t language) override
     {
+        // The index file must not be built by two scans at once, a background scan is superseded by this one.
+        WaitForBackgroundScan();
+
         ImportMegaPark();
+        SetScenarios(_fileIndex.LoadOrBuild(language));
 
-        // Reload scenarios from index
-        _scenarios.clear();
-        auto scenarios = _fileIndex.LoadOrBuild(language);
-        for (const auto& scenario : scenarios)
+        // Make sure the highscores file contains all records before reading it
+        WaitForHighscoreSave();
+        LoadScores();
+        LoadLegacyScores();
+        AttachHighscores();
+    }
+
+    void ScanInBackground(int32_t language) override
+    {
+        if (_backgroundScan.valid())
         {
-            AddScenario(scenario);
+            return;
         }
 
-        // Sort the scenarios and load the highscores
-        Sort();
-        LoadScores();
-        LoadLegacyScores();
+        // The progress window belongs to the UI thread, so the background scan does not report progress
+        _backgroundScan = std::async(std::launch::async, [this, language]() {
+            ImportMegaPark();
+            return _fileIndex.LoadOrBuild(language, false);
+        });
+    }
+
+    bool ApplyBackgroundScan() override
+    {
+        if (!_backgroundScan.valid() || _backgroundScan.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return false;
+        }
+
+        try
+        {
+            SetScenarios(_backgroundScan.get());
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Unable to scan scenarios: %s", e.what());
+            return false;
+        }
+
+        // The highscores in memory are up to date, they only need to be attached to the new entries
         AttachHighscores();
+        return true;
     }
 
     size_t GetCount() const override
@@ -421,6 +467,31 @@ private:
         return const_cast<ScenarioIndexEntry*>(repo->GetByPath(path));
     }
 
+    void SetScenarios(const std::vector<ScenarioIndexEntry>& scenarios)
+    {
+        _scenarios.clear();
+        for (const auto& scenario : scenarios)
+        {
+            AddScenario(scenario);
+        }
+        Sort();
+    }
+
+    void WaitForBackgroundScan()
+    {
+        if (_backgroundScan.valid())
+        {
+            try
+            {
+                _backgroundScan.get();
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR("Unable to scan scenarios: %s", e.what());
+            }
+        }
+    }
+
     /**
      * Mega Park from RollerCoaster Tycoon 1 is stored in an encrypted hidden file: mp.dat.
      * Decrypt the file and save it as sc21.sc4 in the user's scenario directory.
@@ -658,25 +729,88 @@ private:
         }
     }
 
+    /**
+     * Queues the current highscores to be written in the background.
+     */
     void SaveHighscores()
     {
-        std::string path = _env->GetFilePath(PATHID::SCORES);
+        std::vector<ScenarioHighscoreEntry> highscores;
+        highscores.reserve(_highscores.size());
+        for (const auto* highscore : _highscores)
+        {
+            highscores.push_back(*highscore);
+        }
+
+        std::lock_guard<std::mutex> lock(_highscoreSaveMutex);
+        _pendingHighscores = std::move(highscores);
+        if (!_highscoreSaveRunning)
+        {
+            _highscoreSaveRunning = true;
+            _highscoreSave = std::async(std::launch::async, [this, path = _env->GetFilePath(PATHID::SCORES)]() {
+                WritePendingHighscores(path);
+            });
+        }
+    }
+
+    void WritePendingHighscores(const std::string& path)
+    {
+        while (true)
+        {
+            std::vector<ScenarioHighscoreEntry> highscores;
+            {
+                std::lock_guard<std::mutex> lock(_highscoreSaveMutex);
+                if (!_pendingHighscores.has_value())
+                {
+                    _highscoreSaveRunning = false;
+                    return;
+                }
+                highscores = std::move(*_pendingHighscores);
+                _pendingHighscores.reset();
+            }
+            WriteHighscores(path, highscores);
+        }
+    }
+
+    void WaitForHighscoreSave()
+    {
+        std::future<void> save;
+        {
+            std::lock_guard<std::mutex> lock(_highscoreSaveMutex);
+            save = std::move(_highscoreSave);
+        }
+        if (save.valid())
+        {
+            save.wait();
+        }
+    }
+
+    static void WriteHighscores(const std::string& path, const std::vector<ScenarioHighscoreEntry>& highscores)
+    {
+        // Write to a temporary file first so a crash during the write can not corrupt the existing highscores.
+        const auto tempPath = path + ".tmp";
         try
         {
-            auto fs = FileStream(path, FILE_MODE_WRITE);
-            fs.WriteValue<uint32_t>(HighscoreFileVersion);
-            fs.WriteValue<uint32_t>(static_cast<uint32_t>(_highscores.size()));
-            for (size_t i = 0; i < _highscores.size(); i++)
             {
-                const ScenarioHighscoreEntry* highscore = _highscores[i];
-                fs.WriteString(highscore->fileName);
-                fs.WriteString(highscore->name);
-                fs.WriteValue(highscore->company_value);
-                fs.WriteValue(highscore->timestamp);
+                auto fs = FileStream(tempPath, FILE_MODE_WRITE);
+                fs.WriteValue<uint32_t>(HighscoreFileVersion);
+                fs.WriteValue<uint32_t>(static_cast<uint32_t>(highscores.size()));
+                for (const auto& highscore : highscores)
+                {
+                    fs.WriteString(highscore.fileName);
+                    fs.WriteString(highscore.name);
+                    fs.WriteValue(highscore.company_value);
+                    fs.WriteValue(highscore.timestamp);
+                }
+            }
+            if (!File::Move(tempPath, path))
+            {
+                File::Delete(tempPath);
+                Console::Error::WriteLine("Unable to save highscores to '%s'", path.c_str());
             }
         }
         catch (const std::exception&)
         {
+            File::Delete(tempPath);
             Console::Error::WriteLine("Unable to save highscores to '%s'", path.c_str());
         }
     }
@@ -698,6 +832,18 @@ void ScenarioRepositoryScan()
     repo->Scan(LocalisationService_GetCurrentLanguage());
 }
 
+void ScenarioRepositoryScanInBackground()
+{
+    IScenarioRepository* repo = GetScenarioRepository();
+    repo->ScanInBackground(LocalisationService_GetCurrentLanguage());
+}
+
+bool ScenarioRepositoryApplyBackgroundScan()
+{
+    IScenarioRepository* repo = GetScenarioRepository();
+    return repo->ApplyBackgroundScan();
+}
+
 size_t ScenarioRepositoryGetCount()
 {
     IScenarioRepository* repo = GetScenarioRepository();
@@ -77,6 +77,18 @@ struct IScenarioRepository
      */
     virtual void Scan(int32_t language) = 0;
 
+    /**
+     * Starts scanning the scenario directories in the background. The current scenarios stay available until
+     * ApplyBackgroundScan replaces them.
+     */
+    virtual void ScanInBackground(int32_t language) = 0;
+
+    /**
+     * Replaces the scenarios with the result of a finished background scan, returns false if there is none.
+     * Previously returned entries are invalidated when this returns true.
+     */
+    virtual bool ApplyBackgroundScan() = 0;
+
     virtual size_t GetCount() const = 0;
     virtual const ScenarioIndexEntry* GetByIndex(size_t index) const = 0;
     virtual const ScenarioIndexEntry* GetByFilename(u8string_view filename) const = 0;
@@ -94,6 +106,8 @@ struct IScenarioRepository
 [[nodiscard]] IScenarioRepository* GetScenarioRepository();
 
 void ScenarioRepositoryScan();
+void ScenarioRepositoryScanInBackground();
+[[nodiscard]] bool ScenarioRepositoryApplyBackgroundScan();
 [[nodiscard]] size_t ScenarioRepositoryGetCount();
 [[nodiscard]] const ScenarioIndexEntry* ScenarioRepositoryGetByIndex(size_t index);
 [[nodiscard]] bool ScenarioRepositoryTryRecordHighscore(const utf8* scenarioFileName, money64 companyValue, const utf8* name);
@@ -19,6 +19,7 @@
 #include "../../interface/Window.h"
 #include "../../localisation/LocalisationService.h"
 #include "../../localisation/StringIds.h"
+#include "../../profiling/StartupTrace.h"
 #include "../../windows/Intent.h"
 
 #include <sstream>
@@ -27,7 +28,6 @@ using namespace OpenRCT2;
 
 PreloaderScene::PreloaderScene(IContext& context)
     : Scene(context)
-    , _jobs(1)
 {
 }
 
@@ -54,10 +54,10 @@ void PreloaderScene::Tick()
 
     gInUpdateCode = false;
 
-    if (_jobs.CountPending() == 0 && _jobs.CountProcessing() == 0)
+    if (_tasks.IsIdle())
     {
         // Make sure the job is fully completed.
-        _jobs.Join();
+        _tasks.Wait();
 
         FinishScene();
     }
@@ -67,3 +67,56 @@ void PreloaderScene::Stop()
 {
     Audio::StopAll();
 }
+
+PreloaderScene::JobId PreloaderScene::AddJob(
+    std::string_view name, std::function<void()> fn, std::initializer_list<JobId> dependencies)
+{
+    std::lock_guard<std::mutex> lock(_jobsMutex);
+    const auto id = _jobs.size();
+    auto& job = _jobs.emplace_back();
+    job.Name = name;
+    job.Fn = std::move(fn);
+    for (auto dependency : dependencies)
+    {
+        auto& dependencyJob = _jobs[dependency];
+        if (!dependencyJob.Complete)
+        {
+            dependencyJob.Dependents.push_back(id);
+            job.RemainingDependencies++;
+        }
+    }
+    if (job.RemainingDependencies == 0)
+    {
+        _tasks.Run([this, id]() { RunJob(id); });
+    }
+    return id;
+}
+
+void PreloaderScene::RunJob(JobId id)
+{
+    std::string name;
+    std::function<void()> fn;
+    {
+        std::lock_guard<std::mutex> lock(_jobsMutex);
+        name = _jobs[id].Name;
+        fn = std::move(_jobs[id].Fn);
+    }
+
+    {
+        StartupTrace::Scope traceScope(name);
+        fn();
+    }
+
+    // Queue the jobs that are now ready before this task completes, so the scene never sees the task group idle
+    // while work is left.
+    std::lock_guard<std::mutex> lock(_jobsMutex);
+    auto& job = _jobs[id];
+    job.Complete = true;
+    for (auto dependent : job.Dependents)
+    {
+        if (--_jobs[dependent].RemainingDependencies == 0)
+        {
+            _tasks.Run([this, dependent]() { RunJob(dependent); });
+        }
+    }
+}
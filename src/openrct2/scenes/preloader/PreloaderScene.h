@@ -9,10 +9,17 @@
 
 #pragma once
 
-#include "../../core/JobPool.h"
+#include "../../core/JobScheduler.h"
 #include "../../drawing/Drawing.h"
 #include "../Scene.h"
 
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace OpenRCT2
 {
     class PreloaderScene final : public Scene
@@ -23,12 +30,29 @@ namespace OpenRCT2
         void Load() override;
         void Tick() override;
         void Stop() override;
-        void AddJob(const std::function<void()>& fn)
-        {
-            _jobs.AddTask(fn);
-        }
+
+        using JobId = size_t;
+
+        /**
+         * Queues a job to run in the background once all of its dependencies are complete. Jobs that do not depend
+         * on each other run concurrently. The time spent in each job is recorded in the startup trace.
+         */
+        JobId AddJob(std::string_view name, std::function<void()> fn, std::initializer_list<JobId> dependencies = {});
 
     private:
-        JobPool _jobs;
+        struct Job
+        {
+            std::string Name;
+            std::function<void()> Fn;
+            std::vector<JobId> Dependents;
+            size_t RemainingDependencies{};
+            bool Complete{};
+        };
+
+        TaskGroup _tasks;
+        std::mutex _jobsMutex;
+        std::vector<Job> _jobs;
+
+        void RunJob(JobId id);
     };
 } // namespace OpenRCT2
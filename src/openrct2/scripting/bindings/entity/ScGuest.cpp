@@ -234,6 +234,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->TshirtColour = value;
             peep->Invalidate();
         }
@@ -250,6 +251,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->TrousersColour = value;
             peep->Invalidate();
         }
@@ -266,6 +268,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->BalloonColour = value;
             peep->Invalidate();
         }
@@ -282,6 +285,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->HatColour = value;
             peep->Invalidate();
         }
@@ -298,6 +302,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->UmbrellaColour = value;
             peep->Invalidate();
         }
@@ -314,6 +319,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->Happiness = value;
         }
     }
@@ -329,6 +335,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->HappinessTarget = value;
         }
     }
@@ -344,6 +351,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->Nausea = value;
         }
     }
@@ -359,6 +367,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->NauseaTarget = value;
         }
     }
@@ -374,6 +383,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->Hunger = value;
         }
     }
@@ -389,6 +399,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->Thirst = value;
         }
     }
@@ -404,6 +415,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->Toilet = value;
         }
     }
@@ -419,6 +431,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->Mass = value;
         }
     }
@@ -434,6 +447,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->Intensity = peep->Intensity.WithMinimum(value);
         }
     }
@@ -449,6 +463,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->Intensity = peep->Intensity.WithMaximum(value);
         }
     }
@@ -464,6 +479,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->NauseaTolerance = static_cast<PeepNauseaTolerance>(std::min<uint8_t>(value, 3));
         }
     }
@@ -479,6 +495,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->CashInPocket = std::max(0, value);
         }
     }
@@ -506,6 +523,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->GuestIsLostCountdown = value;
         }
     }
@@ -539,6 +557,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             auto& gameState = GetGameState();
             if (value.type() == DukValue::Type::NUMBER && value.as_uint() < gameState.Rides.size()
                 && gameState.Rides[value.as_uint()].type != RIDE_TYPE_NULL)
@@ -753,6 +772,7 @@ namespace OpenRCT2::Scripting
         {
             return;
         }
+        EntityInvalidateChecksum(peep);
 
         // GuestItem
         if (item["type"].type() != DukValue::Type::STRING)
@@ -855,6 +875,7 @@ namespace OpenRCT2::Scripting
         {
             // Since guests can only have one item of a type and this item matches, remove it.
             auto peep = GetGuest();
+            EntityInvalidateChecksum(peep);
             peep->RemoveItem(ShopItemMap[item["type"].as_string()]);
             peep->UpdateSpriteType();
         }
@@ -866,6 +887,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->RemoveAllItems();
             peep->UpdateSpriteType();
         }
@@ -938,6 +960,7 @@ namespace OpenRCT2::Scripting
         }
 
         auto* peep = GetGuest();
+        EntityInvalidateChecksum(peep);
         peep->ActionSpriteType = peep->NextActionSpriteType = *newType;
 
         auto offset = 0;
@@ -970,6 +993,7 @@ namespace OpenRCT2::Scripting
         ThrowIfGameStateNotMutable();
 
         auto* peep = GetGuest();
+        EntityInvalidateChecksum(peep);
 
         auto& animationGroup = GetPeepAnimation(peep->SpriteType, peep->ActionSpriteType);
         auto length = animationGroup.frame_offsets.size();
@@ -69,6 +69,7 @@ namespace OpenRCT2::Scripting
         if (it == LitterTypeMap.end())
             return;
         auto* litter = GetLitter();
+        EntityInvalidateChecksum(litter);
         litter->SubType = it->second;
     }
 
@@ -88,6 +88,7 @@ namespace OpenRCT2::Scripting
             auto peep = GetPeep();
             if (peep != nullptr)
             {
+                EntityInvalidateChecksum(peep);
                 peep->SetName(value);
             }
         }
@@ -109,6 +110,7 @@ namespace OpenRCT2::Scripting
             auto peep = GetPeep();
             if (peep != nullptr)
             {
+                EntityInvalidateChecksum(peep);
                 auto mask = PeepFlagMap[key];
                 if (value)
                     peep->PeepFlags |= mask;
@@ -135,6 +137,7 @@ namespace OpenRCT2::Scripting
             auto peep = GetPeep();
             if (peep != nullptr)
             {
+                EntityInvalidateChecksum(peep);
                 auto pos = FromDuk<CoordsXY>(value);
                 peep->SetDestination(pos);
                 peep->Invalidate();
@@ -153,6 +156,7 @@ namespace OpenRCT2::Scripting
             auto peep = GetPeep();
             if (peep != nullptr && value < kNumOrthogonalDirections)
             {
+                EntityInvalidateChecksum(peep);
                 peep->PeepDirection = value;
                 peep->Orientation = value << 3;
             }
@@ -169,6 +173,7 @@ namespace OpenRCT2::Scripting
             auto peep = GetPeep();
             if (peep != nullptr)
             {
+                EntityInvalidateChecksum(peep);
                 value = std::clamp(value, kPeepMinEnergy, kPeepMaxEnergy);
                 peep->Energy = value;
             }
@@ -185,6 +190,7 @@ namespace OpenRCT2::Scripting
             auto peep = GetPeep();
             if (peep != nullptr)
             {
+                EntityInvalidateChecksum(peep);
                 value = std::clamp(value, kPeepMinEnergy, kPeepMaxEnergyTarget);
                 peep->EnergyTarget = value;
             }
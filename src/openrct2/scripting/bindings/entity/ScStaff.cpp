@@ -113,6 +113,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetStaff();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             if (value == "handyman" && peep->AssignedStaffType != StaffType::Handyman)
             {
                 peep->AssignedStaffType = StaffType::Handyman;
@@ -152,6 +153,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetStaff();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->TshirtColour = value;
             peep->TrousersColour = value;
         }
@@ -243,6 +245,7 @@ namespace OpenRCT2::Scripting
         {
             return;
         }
+        EntityInvalidateChecksum(peep);
 
         auto& availableCostumes = costumesByStaffType(peep->AssignedStaffType);
 
@@ -287,6 +290,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetStaff();
         if (peep != nullptr)
         {
+            EntityInvalidateChecksum(peep);
             peep->StaffOrders = value;
         }
     }
@@ -373,6 +377,7 @@ namespace OpenRCT2::Scripting
         ThrowIfGameStateNotMutable();
 
         auto* peep = GetStaff();
+        EntityInvalidateChecksum(peep);
         auto& animationGroups = animationsByStaffType(peep->AssignedStaffType);
         auto newType = animationGroups.TryGet(groupKey);
         if (newType == std::nullopt)
@@ -412,6 +417,7 @@ namespace OpenRCT2::Scripting
         ThrowIfGameStateNotMutable();
 
         auto* peep = GetStaff();
+        EntityInvalidateChecksum(peep);
 
         auto& animationGroup = GetPeepAnimation(peep->SpriteType, peep->ActionSpriteType);
         auto length = animationGroup.frame_offsets.size();
@@ -106,6 +106,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->ride_subtype = value;
         }
     }
@@ -121,6 +122,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->vehicle_type = value;
         }
     }
@@ -136,6 +138,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->Pitch = value;
         }
     }
@@ -151,6 +154,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->ride = RideId::FromUnderlying(value);
         }
     }
@@ -166,6 +170,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->num_seats &= ~kVehicleSeatNumMask;
             vehicle->num_seats |= value & kVehicleSeatNumMask;
         }
@@ -190,6 +195,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             if (value.type() == DukValue::Type::NUMBER)
             {
                 vehicle->next_vehicle_on_train = EntityId::FromUnderlying(value.as_uint());
@@ -220,6 +226,7 @@ namespace OpenRCT2::Scripting
         auto* vehicle = GetVehicle();
         if (vehicle == nullptr)
             return;
+        EntityInvalidateChecksum(vehicle);
 
         if (value.type() == DukValue::Type::NUMBER)
         {
@@ -250,6 +257,7 @@ namespace OpenRCT2::Scripting
         auto* vehicle = GetVehicle();
         if (vehicle == nullptr)
             return;
+        EntityInvalidateChecksum(vehicle);
 
         if (value.type() == DukValue::Type::NUMBER)
         {
@@ -272,6 +280,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->current_station = StationIndex::FromUnderlying(value);
         }
     }
@@ -287,6 +296,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->mass = value;
         }
     }
@@ -302,6 +312,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->acceleration = value;
         }
     }
@@ -317,6 +328,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->velocity = value;
         }
     }
@@ -332,6 +344,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->bank_rotation = value;
         }
     }
@@ -348,6 +361,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             if (value)
             {
                 vehicle->SetFlag(flag);
@@ -375,6 +389,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->colours = FromDuk<VehicleColour>(value);
         }
     }
@@ -401,6 +416,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             auto x = AsOrDefault(value["x"], 0);
             auto y = AsOrDefault(value["y"], 0);
             auto z = AsOrDefault(value["z"], 0);
@@ -439,6 +455,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->powered_acceleration = value;
         }
     }
@@ -454,6 +471,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->speed = value;
         }
     }
@@ -473,6 +491,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->status = VehicleStatusMap[value];
         }
     }
@@ -492,6 +511,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->spin_sprite = value;
         }
     }
@@ -540,6 +560,7 @@ namespace OpenRCT2::Scripting
         auto vehicle = GetVehicle();
         if (vehicle != nullptr)
         {
+            EntityInvalidateChecksum(vehicle);
             vehicle->MoveRelativeDistance(value);
         }
     }
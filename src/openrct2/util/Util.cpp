@@ -343,6 +343,150 @@ std::vector<uint8_t> Ungzip(const void* data, const size_t dataLen)
     return output;
 }
 
+DeflatedSegment DeflateSegment(const void* data, const size_t dataLen)
+{
+    assert(data != nullptr);
+
+    DeflatedSegment segment;
+    segment.Length = dataLen;
+    segment.Crc32 = 0;
+
+    z_stream strm{};
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+
+    {
+        // Negative window bits write raw deflate data without a gzip header or trailer
+        const auto ret = deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+        if (ret != Z_OK)
+        {
+            throw std::runtime_error("deflateInit2 failed with error " + std::to_string(ret));
+        }
+    }
+
+    auto& output = segment.Data;
+    int flush = 0;
+    const auto* src = static_cast<const Bytef*>(data);
+    size_t srcRemaining = dataLen;
+    do
+    {
+        const auto nextBlockSize = std::min(srcRemaining, CHUNK);
+        const auto outputBlockSize = std::max<size_t>(nextBlockSize, 64);
+        srcRemaining -= nextBlockSize;
+
+        // A sync flush pads the data to a byte boundary but does not mark the last block as final
+        flush = srcRemaining == 0 ? Z_SYNC_FLUSH : Z_NO_FLUSH;
+        segment.Crc32 = crc32(segment.Crc32, src, static_cast<uInt>(nextBlockSize));
+        strm.avail_in = static_cast<uInt>(nextBlockSize);
+        strm.next_in = const_cast<Bytef*>(src);
+        do
+        {
+            output.resize(output.size() + outputBlockSize);
+            strm.avail_out = static_cast<uInt>(outputBlockSize);
+            strm.next_out = &output[output.size() - outputBlockSize];
+            const auto ret = deflate(&strm, flush);
+            if (ret == Z_STREAM_ERROR)
+            {
+                throw std::runtime_error("deflate failed with error " + std::to_string(ret));
+            }
+            output.resize(output.size() - strm.avail_out);
+        } while (strm.avail_out == 0);
+
+        src += nextBlockSize;
+    } while (flush != Z_SYNC_FLUSH);
+    deflateEnd(&strm);
+    return segment;
+}
+
+/**
+ * Joins deflated segments into a single gzip stream that can be read with Ungzip. The offset of each segment within
+ * the result is returned, so each one can also be inflated on its own with InflateSegment.
+ */
+std::vector<uint8_t> GzipJoinSegments(const std::vector<DeflatedSegment>& segments, std::vector<uint64_t>& segmentOffsets)
+{
+    // Deflate method, no flags, no modification time, unknown operating system
+    constexpr uint8_t kHeader[] = { 0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF };
+    // An empty final block with fixed codes, which ends the deflate stream
+    constexpr uint8_t kFinalBlock[] = { 0x03, 0x00 };
+
+    std::vector<uint8_t> output(std::begin(kHeader), std::end(kHeader));
+    segmentOffsets.clear();
+    uLong crc = crc32(0, Z_NULL, 0);
+    uint64_t length = 0;
+    for (const auto& segment : segments)
+    {
+        segmentOffsets.push_back(output.size());
+        output.insert(output.end(), segment.Data.begin(), segment.Data.end());
+        crc = crc32_combine(crc, segment.Crc32, static_cast<z_off_t>(segment.Length));
+        length += segment.Length;
+    }
+    output.insert(output.end(), std::begin(kFinalBlock), std::end(kFinalBlock));
+
+    // Trailer: CRC-32 and the length modulo 2^32, both little endian
+    for (const auto value : { static_cast<uint32_t>(crc), static_cast<uint32_t>(length) })
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            output.push_back(static_cast<uint8_t>(value >> (i * 8)));
+        }
+    }
+    return output;
+}
+
+/**
+ * Inflates a single segment written by DeflateSegment. At most maxLen + 1 bytes are inflated, so a segment that
+ * inflates to more than expected is detected without inflating all of it.
+ */
+std::vector<uint8_t> InflateSegment(const void* data, const size_t dataLen, const size_t maxLen)
+{
+    assert(data != nullptr);
+
+    z_stream strm{};
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+
+    {
+        const auto ret = inflateInit2(&strm, -15);
+        if (ret != Z_OK)
+        {
+            throw std::runtime_error("inflateInit2 failed with error " + std::to_string(ret));
+        }
+    }
+
+    std::vector<uint8_t> output(maxLen + 1);
+    const auto* src = static_cast<const Bytef*>(data);
+    size_t srcRemaining = dataLen;
+    size_t outputRemaining = output.size();
+    int ret = Z_OK;
+    while (ret == Z_OK && srcRemaining != 0 && outputRemaining != 0)
+    {
+        const auto nextBlockSize = std::min(srcRemaining, CHUNK);
+        const auto outputBlockSize = std::min(outputRemaining, CHUNK);
+        strm.avail_in = static_cast<uInt>(nextBlockSize);
+        strm.next_in = const_cast<Bytef*>(src);
+        strm.avail_out = static_cast<uInt>(outputBlockSize);
+        strm.next_out = &output[output.size() - outputRemaining];
+
+        // The segment has no final block, so the stream ends when all of its data is consumed
+        ret = inflate(&strm, Z_SYNC_FLUSH);
+        if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR)
+        {
+            inflateEnd(&strm);
+            throw std::runtime_error("inflate failed with error " + std::to_string(ret));
+        }
+
+        src += nextBlockSize - strm.avail_in;
+        srcRemaining -= nextBlockSize - strm.avail_in;
+        outputRemaining -= outputBlockSize - strm.avail_out;
+    }
+    inflateEnd(&strm);
+
+    output.resize(output.size() - outputRemaining);
+    return output;
+}
+
 uint8_t Lerp(uint8_t a, uint8_t b, float t)
 {
     if (t <= 0)
@@ -83,6 +83,21 @@ bool UtilGzipCompress(FILE* source, FILE* dest);
 std::vector<uint8_t> Gzip(const void* data, const size_t dataLen);
 std::vector<uint8_t> Ungzip(const void* data, const size_t dataLen);
 
+/**
+ * Raw deflate data that ends on a byte boundary without a final block, so segments deflated separately can be joined
+ * into a single stream.
+ */
+struct DeflatedSegment
+{
+    std::vector<uint8_t> Data;
+    uint32_t Crc32{};
+    size_t Length{};
+};
+
+DeflatedSegment DeflateSegment(const void* data, const size_t dataLen);
+std::vector<uint8_t> GzipJoinSegments(const std::vector<DeflatedSegment>& segments, std::vector<uint64_t>& segmentOffsets);
+std::vector<uint8_t> InflateSegment(const void* data, const size_t dataLen, const size_t maxLen);
+
 template<typename T> constexpr T AddClamp(T value, T valueToAdd)
 {
     if (std::is_same_v<decltype(value), money64>)
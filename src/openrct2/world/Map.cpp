@@ -37,6 +37,7 @@
 #include "../object/ObjectManager.h"
 #include "../object/SmallSceneryEntry.h"
 #include "../object/TerrainSurfaceObject.h"
+#include "../paint/Paint.TileCache.h"
 #include "../profiling/Profiling.h"
 #include "../ride/RideConstruction.h"
 #include "../ride/RideData.h"
@@ -154,6 +155,9 @@ void SetTileElements(std::vector<TileElement>&& tileElements)
     _tileIndex = TilePointerIndex<TileElement>(
         kMaximumMapSizeTechnical, gameState.TileElements.data(), gameState.TileElements.size());
     _tileElementsInUse = gameState.TileElements.size();
+
+    // Paint structs point at the elements, which have all moved
+    PaintTileCacheInvalidate();
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -1181,6 +1185,7 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
 
     // Set tile index pointer to point to new element block
     _tileIndex.SetTile(tileLoc, newTileElement);
+    PaintTileCacheInvalidateTile(loc);
 
     bool isLastForTile = false;
     if (originalTileElement == nullptr)
@@ -1773,6 +1778,8 @@ bool MapLargeScenerySignSetColour(const CoordsXYZD& signPos, int32_t sequence, u
 
 static void MapInvalidateTileUnderZoom(int32_t x, int32_t y, int32_t z0, int32_t z1, ZoomLevel maxZoom)
 {
+    PaintTileCacheInvalidateTile({ x, y });
+
     if (gOpenRCT2Headless)
         return;
 
@@ -1822,6 +1829,14 @@ void MapInvalidateElement(const CoordsXY& elementPos, TileElement* tileElement)
 
 void MapInvalidateRegion(const CoordsXY& mins, const CoordsXY& maxs)
 {
+    for (int32_t y = mins.y; y <= maxs.y; y += kCoordsXYStep)
+    {
+        for (int32_t x = mins.x; x <= maxs.x; x += kCoordsXYStep)
+        {
+            PaintTileCacheInvalidateTile({ x, y });
+        }
+    }
+
     int32_t x0, y0, x1, y1, left, right, top, bottom;
 
     x0 = mins.x + 16;
@@ -0,0 +1,150 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/core/File.h>
+#include <openrct2/core/FileSystem.hpp>
+#include <openrct2/core/Path.hpp>
+#include <openrct2/object/DatObjectCache.h>
+#include <openrct2/util/SawyerCoding.h>
+#include <cstring>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class DatObjectCacheTest : public testing::Test
+{
+protected:
+    u8string _directory;
+    u8string _cacheDirectory;
+    u8string _objectPath;
+
+    void SetUp() override
+    {
+        _directory = (fs::temp_directory_path() / "openrct2_dat_object_cache_test").u8string();
+        fs::remove_all(fs::u8path(_directory));
+        fs::create_directories(fs::u8path(_directory));
+        _cacheDirectory = Path::Combine(_directory, "cache");
+        _objectPath = Path::Combine(_directory, "TEST.DAT");
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(fs::u8path(_directory));
+    }
+
+    static std::vector<uint8_t> CreateChunkData(uint8_t seed)
+    {
+        std::vector<uint8_t> data(4096);
+        for (size_t i = 0; i < data.size(); i++)
+        {
+            // Runs of repeated bytes so the RLE encoding has something to do
+            data[i] = static_cast<uint8_t>(seed + i / 7);
+        }
+        return data;
+    }
+
+    void WriteObject(const std::vector<uint8_t>& chunkData)
+    {
+        RCTObjectEntry entry{};
+        entry.flags = 0x80;
+        entry.SetName("TEST    ");
+        entry.checksum = 0x12345678;
+
+        std::vector<uint8_t> file(sizeof(entry) + sizeof(SawyerCodingChunkHeader) + chunkData.size() * 2);
+        std::memcpy(file.data(), &entry, sizeof(entry));
+
+        SawyerCodingChunkHeader header;
+        header.encoding = CHUNK_ENCODING_RLE;
+        header.length = static_cast<uint32_t>(chunkData.size());
+        auto chunkLength = SawyerCodingWriteChunkBuffer(file.data() + sizeof(entry), chunkData.data(), header);
+        file.resize(sizeof(entry) + chunkLength);
+
+        File::WriteAllBytes(_objectPath, file.data(), file.size());
+    }
+
+    std::vector<u8string> GetCacheFiles() const
+    {
+        std::vector<u8string> files;
+        if (!fs::exists(fs::u8path(_cacheDirectory)))
+            return files;
+
+        for (const auto& entry : fs::directory_iterator(fs::u8path(_cacheDirectory)))
+        {
+            files.push_back(entry.path().u8string());
+        }
+        return files;
+    }
+
+    size_t CountCacheFiles() const
+    {
+        return GetCacheFiles().size();
+    }
+
+    static std::vector<uint8_t> GetData(const DatObjectData& object)
+    {
+        return std::vector<uint8_t>(object.Data, object.Data + object.Length);
+    }
+};
+
+TEST_F(DatObjectCacheTest, read_without_cache)
+{
+    auto chunkData = CreateChunkData(1);
+    WriteObject(chunkData);
+
+    auto object = DatObjectCache::Read(_objectPath, {});
+    ASSERT_EQ(GetData(object), chunkData);
+    ASSERT_EQ(object.Entry.checksum, 0x12345678u);
+    ASSERT_EQ(CountCacheFiles(), 0u);
+}
+
+TEST_F(DatObjectCacheTest, read_from_cache)
+{
+    auto chunkData = CreateChunkData(2);
+    WriteObject(chunkData);
+
+    auto decoded = DatObjectCache::Read(_objectPath, _cacheDirectory);
+    ASSERT_EQ(GetData(decoded), chunkData);
+    ASSERT_EQ(CountCacheFiles(), 1u);
+
+    // Change the decoded chunk in the cache file, only a read from the cache can return it
+    const auto cacheFile = GetCacheFiles()[0];
+    auto cacheData = File::ReadAllBytes(cacheFile);
+    ASSERT_GT(cacheData.size(), chunkData.size());
+    const auto chunkOffset = cacheData.size() - chunkData.size();
+    for (size_t i = 0; i < chunkData.size(); i++)
+    {
+        chunkData[i] ^= 0xFF;
+        cacheData[chunkOffset + i] = chunkData[i];
+    }
+    File::WriteAllBytes(cacheFile, cacheData.data(), cacheData.size());
+
+    auto cached = DatObjectCache::Read(_objectPath, _cacheDirectory);
+    ASSERT_EQ(GetData(cached), chunkData);
+    ASSERT_EQ(cached.Entry, decoded.Entry);
+    ASSERT_EQ(CountCacheFiles(), 1u);
+}
+
+TEST_F(DatObjectCacheTest, changed_file_is_decoded_again)
+{
+    WriteObject(CreateChunkData(3));
+    DatObjectCache::Read(_objectPath, _cacheDirectory);
+
+    auto chunkData = CreateChunkData(4);
+    WriteObject(chunkData);
+
+    // The entry of the old file is replaced rather than kept next to the new one
+    auto object = DatObjectCache::Read(_objectPath, _cacheDirectory);
+    ASSERT_EQ(GetData(object), chunkData);
+    ASSERT_EQ(CountCacheFiles(), 1u);
+
+    auto cached = DatObjectCache::Read(_objectPath, _cacheDirectory);
+    ASSERT_EQ(GetData(cached), chunkData);
+    ASSERT_EQ(CountCacheFiles(), 1u);
+}
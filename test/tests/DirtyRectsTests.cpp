@@ -0,0 +1,107 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/drawing/DirtyRects.h>
+
+using namespace OpenRCT2::Drawing;
+
+static void AssertRect(const ScreenRect& rect, int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    ASSERT_EQ(rect.GetLeft(), left);
+    ASSERT_EQ(rect.GetTop(), top);
+    ASSERT_EQ(rect.GetRight(), right);
+    ASSERT_EQ(rect.GetBottom(), bottom);
+}
+
+static DirtyRects CreateDirtyRects()
+{
+    DirtyRects dirtyRects;
+    dirtyRects.Resize(1920, 1080);
+    dirtyRects.Clear();
+    return dirtyRects;
+}
+
+TEST(DirtyRectsTest, resize_repaints_the_screen)
+{
+    DirtyRects dirtyRects;
+    dirtyRects.Resize(640, 480);
+    ASSERT_TRUE(dirtyRects.IsFull());
+    ASSERT_TRUE(dirtyRects.Contains({ 0, 0, 640, 480 }));
+}
+
+TEST(DirtyRectsTest, rects_are_clipped_to_the_screen)
+{
+    auto dirtyRects = CreateDirtyRects();
+    dirtyRects.Add({ -10, -10, 20, 20 });
+    dirtyRects.Add({ 1900, 1070, 2000, 1100 });
+    dirtyRects.Add({ 2000, 0, 2100, 10 });
+
+    const auto& rects = dirtyRects.GetRects();
+    ASSERT_EQ(rects.size(), 2u);
+    AssertRect(rects[0], 0, 0, 20, 20);
+    AssertRect(rects[1], 1900, 1070, 1920, 1080);
+}
+
+TEST(DirtyRectsTest, nearby_rects_are_merged)
+{
+    auto dirtyRects = CreateDirtyRects();
+
+    // A peep walking a few pixels invalidates two overlapping rects
+    dirtyRects.Add({ 100, 100, 132, 140 });
+    dirtyRects.Add({ 104, 102, 136, 142 });
+    ASSERT_EQ(dirtyRects.GetRects().size(), 1u);
+    AssertRect(dirtyRects.GetRects()[0], 100, 100, 136, 142);
+
+    // Far apart, painting the bounding box would cost more than painting both
+    dirtyRects.Add({ 1000, 800, 1032, 840 });
+    ASSERT_EQ(dirtyRects.GetRects().size(), 2u);
+
+    // Contained rects are dropped
+    dirtyRects.Add({ 110, 110, 120, 120 });
+    ASSERT_EQ(dirtyRects.GetRects().size(), 2u);
+    ASSERT_TRUE(dirtyRects.Contains({ 110, 110, 120, 120 }));
+    ASSERT_FALSE(dirtyRects.Contains({ 90, 110, 120, 120 }));
+    ASSERT_FALSE(dirtyRects.IsFull());
+}
+
+TEST(DirtyRectsTest, merged_rect_merges_again)
+{
+    auto dirtyRects = CreateDirtyRects();
+    dirtyRects.Add({ 0, 0, 100, 100 });
+    dirtyRects.Add({ 200, 0, 300, 100 });
+    ASSERT_EQ(dirtyRects.GetRects().size(), 2u);
+
+    // Fills the gap, so all three become one
+    dirtyRects.Add({ 100, 0, 200, 100 });
+    ASSERT_EQ(dirtyRects.GetRects().size(), 1u);
+    AssertRect(dirtyRects.GetRects()[0], 0, 0, 300, 100);
+}
+
+TEST(DirtyRectsTest, too_many_rects_repaint_the_screen)
+{
+    auto dirtyRects = CreateDirtyRects();
+    for (size_t i = 0; i < DirtyRects::kMaxRects; i++)
+    {
+        const auto x = static_cast<int32_t>(i % 8) * 240;
+        const auto y = static_cast<int32_t>(i / 8) * 135;
+        dirtyRects.Add({ x, y, x + 64, y + 64 });
+    }
+    ASSERT_EQ(dirtyRects.GetRects().size(), DirtyRects::kMaxRects);
+    ASSERT_FALSE(dirtyRects.IsFull());
+
+    dirtyRects.Add({ 1900, 1060, 1910, 1070 });
+    ASSERT_TRUE(dirtyRects.IsFull());
+    ASSERT_EQ(dirtyRects.GetRects().size(), 1u);
+    AssertRect(dirtyRects.GetRects()[0], 0, 0, 1920, 1080);
+
+    dirtyRects.Clear();
+    ASSERT_FALSE(dirtyRects.IsFull());
+    ASSERT_TRUE(dirtyRects.GetRects().empty());
+}
@@ -0,0 +1,69 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/object/ImageDataPool.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static std::vector<uint8_t> CreateImageData(uint8_t seed)
+{
+    std::vector<uint8_t> data(256);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(seed * 31 + i);
+    }
+    return data;
+}
+
+TEST(ImageDataPoolTest, identical_data_is_shared)
+{
+    auto data = CreateImageData(1);
+    auto copy = data;
+    const auto before = ImageDataPool::GetStats();
+
+    auto a = ImageDataPool::Add(data.data(), data.size());
+    auto b = ImageDataPool::Add(copy.data(), copy.size());
+    ASSERT_EQ(a.get(), b.get());
+    ASSERT_EQ(std::vector<uint8_t>(a.get(), a.get() + data.size()), data);
+
+    const auto after = ImageDataPool::GetStats();
+    ASSERT_EQ(after.UniqueImages - before.UniqueImages, 1u);
+    ASSERT_EQ(after.ReferencedImages - before.ReferencedImages, 2u);
+    ASSERT_EQ(after.GetSavedBytes() - before.GetSavedBytes(), data.size());
+}
+
+TEST(ImageDataPoolTest, different_data_is_not_shared)
+{
+    auto data = CreateImageData(2);
+    auto other = CreateImageData(3);
+    auto shorter = CreateImageData(2);
+    shorter.pop_back();
+
+    auto a = ImageDataPool::Add(data.data(), data.size());
+    auto b = ImageDataPool::Add(other.data(), other.size());
+    auto c = ImageDataPool::Add(shorter.data(), shorter.size());
+    ASSERT_NE(a.get(), b.get());
+    ASSERT_NE(a.get(), c.get());
+}
+
+TEST(ImageDataPoolTest, released_data_is_not_counted)
+{
+    auto data = CreateImageData(4);
+    const auto before = ImageDataPool::GetStats();
+    {
+        auto a = ImageDataPool::Add(data.data(), data.size());
+        auto b = ImageDataPool::Add(data.data(), data.size());
+    }
+
+    const auto after = ImageDataPool::GetStats();
+    ASSERT_EQ(after.UniqueImages, before.UniqueImages);
+    ASSERT_EQ(after.ReferencedBytes, before.ReferencedBytes);
+}
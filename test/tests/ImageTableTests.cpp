@@ -0,0 +1,155 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/object/ImageTable.h>
+#include <openrct2/object/Object.h>
+#include <stdexcept>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class TestReadObjectContext final : public IReadObjectContext
+{
+public:
+    std::string_view GetObjectIdentifier() override
+    {
+        return "test";
+    }
+
+    IObjectRepository& GetObjectRepository() override
+    {
+        throw std::runtime_error("Not used by image tables.");
+    }
+
+    bool ShouldLoadImages() override
+    {
+        return true;
+    }
+
+    std::vector<uint8_t> GetData(std::string_view path) override
+    {
+        return {};
+    }
+
+    ObjectAsset GetAsset(std::string_view path) override
+    {
+        return {};
+    }
+
+    void LogVerbose(ObjectError code, const utf8* text) override
+    {
+    }
+
+    void LogWarning(ObjectError code, const utf8* text) override
+    {
+    }
+
+    void LogError(ObjectError code, const utf8* text) override
+    {
+    }
+};
+
+// A 4x2 RLE image that stores its second row before the first one
+static const std::vector<uint8_t> kOutOfOrderImage = {
+    8, 0, 4, 0,             // row offsets
+    0x82, 1, 21, 22,        // row 1
+    0x84, 0, 11, 12, 13, 14 // row 0
+};
+
+static constexpr int16_t kBitmapSize = 32;
+
+static void WriteImage(MemoryStream& stream, uint32_t offset, int16_t width, int16_t height, uint16_t flags)
+{
+    stream.WriteValue<uint32_t>(offset);
+    stream.WriteValue<int16_t>(width);
+    stream.WriteValue<int16_t>(height);
+    stream.WriteValue<int16_t>(0);
+    stream.WriteValue<int16_t>(0);
+    stream.WriteValue<uint16_t>(flags);
+    stream.WriteValue<uint16_t>(0);
+}
+
+// Reads a table that follows propertiesLength bytes of object properties, like the image table of a legacy object
+static void ReadTable(ImageTable& table, uint8_t bitmapSeed, size_t propertiesLength = 0)
+{
+    std::vector<uint8_t> bitmap(kBitmapSize * kBitmapSize);
+    for (size_t i = 0; i < bitmap.size(); i++)
+    {
+        bitmap[i] = static_cast<uint8_t>(bitmapSeed + i);
+    }
+
+    MemoryStream stream;
+    for (size_t i = 0; i < propertiesLength; i++)
+    {
+        stream.WriteValue<uint8_t>(0xFF);
+    }
+    stream.WriteValue<uint32_t>(2);
+    stream.WriteValue<uint32_t>(static_cast<uint32_t>(kOutOfOrderImage.size() + bitmap.size()));
+    WriteImage(stream, 0, 4, 2, G1_FLAG_RLE_COMPRESSION);
+    WriteImage(stream, static_cast<uint32_t>(kOutOfOrderImage.size()), kBitmapSize, kBitmapSize, G1_FLAG_HAS_TRANSPARENCY);
+    stream.Write(kOutOfOrderImage.data(), kOutOfOrderImage.size());
+    stream.Write(bitmap.data(), bitmap.size());
+    stream.SetPosition(propertiesLength);
+
+    TestReadObjectContext context;
+    table.Read(&context, &stream);
+}
+
+TEST(ImageTableTest, rle_image_keeps_rows_stored_out_of_order)
+{
+    ImageTable table;
+    ReadTable(table, 1);
+    ASSERT_EQ(table.GetCount(), 2u);
+
+    const auto& image = table.GetImages()[0];
+    ASSERT_NE(image.offset, nullptr);
+    ASSERT_EQ(std::vector<uint8_t>(image.offset, image.offset + kOutOfOrderImage.size()), kOutOfOrderImage);
+    ASSERT_EQ(table.GetDataSize(), kOutOfOrderImage.size() + kBitmapSize * kBitmapSize);
+}
+
+TEST(ImageTableTest, only_large_images_are_shared)
+{
+    ImageTable a;
+    ImageTable b;
+    ImageTable c;
+    ReadTable(a, 1);
+    ReadTable(b, 1);
+    ReadTable(c, 2);
+
+    ASSERT_NE(a.GetImages()[0].offset, b.GetImages()[0].offset);
+    ASSERT_EQ(a.GetImages()[1].offset, b.GetImages()[1].offset);
+    ASSERT_NE(a.GetImages()[1].offset, c.GetImages()[1].offset);
+}
+
+TEST(ImageTableTest, released_data_is_taken_from_a_table_read_again)
+{
+    ImageTable table;
+    ReadTable(table, 1, 17);
+    ASSERT_EQ(table.GetLegacyOffset(), 17u);
+    ASSERT_TRUE(table.CanReadDataAgain());
+    const auto expected = std::vector<uint8_t>(
+        table.GetImages()[1].offset, table.GetImages()[1].offset + kBitmapSize * kBitmapSize);
+
+    table.ReleaseData();
+    ASSERT_EQ(table.GetImages()[1].offset, nullptr);
+
+    ImageTable newTable;
+    ReadTable(newTable, 1, 17);
+    ASSERT_TRUE(table.TakeData(newTable));
+    const auto& image = table.GetImages()[1];
+    ASSERT_NE(image.offset, nullptr);
+    ASSERT_EQ(std::vector<uint8_t>(image.offset, image.offset + kBitmapSize * kBitmapSize), expected);
+
+    // Images added after reading, like the palette of a water object, can not be read from the object file again
+    G1Element palette{};
+    table.AddImage(&palette);
+    ASSERT_FALSE(table.CanReadDataAgain());
+}
@@ -0,0 +1,112 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <array>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <numeric>
+#include <openrct2/core/JobScheduler.h>
+#include <stdexcept>
+#include <vector>
+
+using namespace OpenRCT2;
+
+TEST(JobSchedulerTest, task_group_runs_all_tasks)
+{
+    std::atomic<int32_t> count{ 0 };
+    TaskGroup group;
+    for (int32_t i = 0; i < 1000; i++)
+    {
+        group.Run([&count]() { count++; });
+    }
+    group.Wait();
+    ASSERT_EQ(count.load(), 1000);
+    ASSERT_TRUE(group.IsIdle());
+}
+
+TEST(JobSchedulerTest, large_task_is_heap_allocated)
+{
+    std::array<int32_t, 64> values{};
+    std::iota(values.begin(), values.end(), 0);
+
+    std::atomic<int32_t> sum{ 0 };
+    TaskGroup group;
+    group.Run([values, &sum]() { sum += std::accumulate(values.begin(), values.end(), 0); });
+    group.Wait();
+    ASSERT_EQ(sum.load(), 2016);
+}
+
+TEST(JobSchedulerTest, move_only_task)
+{
+    auto value = std::make_unique<int32_t>(42);
+    int32_t result = 0;
+    TaskGroup group;
+    group.Run([value = std::move(value), &result]() { result = *value; });
+    group.Wait();
+    ASSERT_EQ(result, 42);
+}
+
+TEST(JobSchedulerTest, parallel_for)
+{
+    std::vector<int32_t> values(10000);
+    ParallelFor(0, values.size(), [&values](size_t i) { values[i] = static_cast<int32_t>(i) * 2; });
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        ASSERT_EQ(values[i], static_cast<int32_t>(i) * 2);
+    }
+}
+
+TEST(JobSchedulerTest, nested_groups)
+{
+    std::atomic<int32_t> count{ 0 };
+    ParallelFor(
+        0, 16,
+        [&count](size_t) {
+            TaskGroup inner;
+            for (int32_t i = 0; i < 16; i++)
+            {
+                inner.Run([&count]() { count++; });
+            }
+            inner.Wait();
+        },
+        1);
+    ASSERT_EQ(count.load(), 256);
+}
+
+TEST(JobSchedulerTest, exception_is_rethrown)
+{
+    std::atomic<int32_t> count{ 0 };
+    TaskGroup group;
+    for (int32_t i = 0; i < 10; i++)
+    {
+        group.Run([i, &count]() {
+            count++;
+            if (i == 5)
+                throw std::runtime_error("task failed");
+        });
+    }
+    ASSERT_THROW(group.Wait(), std::runtime_error);
+    ASSERT_EQ(count.load(), 10);
+}
+
+TEST(JobSchedulerTest, set_thread_count)
+{
+    auto& scheduler = JobScheduler::Get();
+    const auto previousCount = scheduler.GetThreadCount();
+
+    scheduler.SetThreadCount(3);
+    ASSERT_EQ(scheduler.GetThreadCount(), 3u);
+
+    std::atomic<int32_t> count{ 0 };
+    ParallelFor(0, 100, [&count](size_t) { count++; });
+    ASSERT_EQ(count.load(), 100);
+
+    scheduler.SetThreadCount(previousCount);
+}
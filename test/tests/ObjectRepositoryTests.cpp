@@ -0,0 +1,79 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/localisation/LocalisationService.h>
+#include <openrct2/object/ObjectRepository.h>
+#include <memory>
+
+using namespace OpenRCT2;
+
+static void ExpectSameItem(const ObjectRepositoryItem& expected, const ObjectRepositoryItem& actual)
+{
+    EXPECT_EQ(expected.Id, actual.Id);
+    EXPECT_EQ(expected.Type, actual.Type);
+    EXPECT_EQ(expected.Generation, actual.Generation);
+    EXPECT_EQ(expected.Identifier, actual.Identifier);
+    EXPECT_EQ(expected.ObjectEntry, actual.ObjectEntry);
+    EXPECT_EQ(expected.Path, actual.Path);
+    EXPECT_EQ(expected.Name, actual.Name);
+    EXPECT_EQ(expected.Authors, actual.Authors);
+    EXPECT_EQ(expected.Sources, actual.Sources);
+    EXPECT_EQ(expected.Flags, actual.Flags);
+    EXPECT_EQ(expected.SceneryGroupInfo.Entries.size(), actual.SceneryGroupInfo.Entries.size());
+}
+
+// The second repository finds the index written by the first one unchanged and queries it in place.
+TEST(ObjectRepositoryTest, mapped_index_matches_built_index)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context = CreateContext();
+    ASSERT_NE(context, nullptr);
+    ASSERT_TRUE(context->Initialise());
+
+    const auto language = context->GetLocalisationService().GetCurrentLanguage();
+    auto built = CreateObjectRepository(context->GetPlatformEnvironment());
+    built->Construct(language);
+    auto mapped = CreateObjectRepository(context->GetPlatformEnvironment());
+    mapped->LoadOrConstruct(language);
+
+    ASSERT_GT(built->GetNumObjects(), 0u);
+    ASSERT_EQ(built->GetNumObjects(), mapped->GetNumObjects());
+
+    // Look every object up before anything else reads the mapped items
+    const auto* builtItems = built->GetObjects();
+    for (size_t i = 0; i < built->GetNumObjects(); i++)
+    {
+        const auto& item = builtItems[i];
+        if (!item.Identifier.empty())
+        {
+            const auto* found = mapped->FindObject(item.Identifier);
+            ASSERT_NE(found, nullptr);
+            EXPECT_EQ(built->FindObject(item.Identifier)->Id, found->Id);
+            ExpectSameItem(*built->FindObject(item.Identifier), *found);
+        }
+        if (item.ObjectEntry.name[0] != '\0')
+        {
+            const auto* found = mapped->FindObject(&item.ObjectEntry);
+            ASSERT_NE(found, nullptr);
+            EXPECT_EQ(built->FindObject(&item.ObjectEntry)->Id, found->Id);
+        }
+    }
+    EXPECT_EQ(mapped->FindObject("test.object.that.does.not.exist"), nullptr);
+
+    const auto* mappedItems = mapped->GetObjects();
+    for (size_t i = 0; i < built->GetNumObjects(); i++)
+    {
+        ExpectSameItem(builtItems[i], mappedItems[i]);
+    }
+}
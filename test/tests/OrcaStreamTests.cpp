@@ -0,0 +1,117 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/core/IStream.hpp>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/core/OrcaStream.hpp>
+#include <openrct2/util/Util.h>
+#include <cstring>
+#include <vector>
+
+using namespace OpenRCT2;
+
+constexpr uint32_t kTestChunkId = 0x01;
+constexpr uint32_t kTestValueCount = 64;
+
+// Offsets of header fields and of the Length field of the first chunk entry, after the 64 byte header, the id and
+// the offset
+constexpr size_t kCompressedSizeOffset = 4 + 4 + 4 + 4 + 8 + 4;
+constexpr size_t kFlagsOffset = kCompressedSizeOffset + 8 + 8;
+constexpr size_t kFirstChunkLengthOffset = 64 + 4 + 8;
+constexpr size_t kChunkDataOffset = 64 + 4 + 8 + 8;
+
+static std::vector<uint8_t> WriteTestFile()
+{
+    MemoryStream ms;
+    {
+        OrcaStream orca(ms, OrcaStream::Mode::WRITING);
+        orca.ReadWriteChunk(kTestChunkId, [](OrcaStream::ChunkStream& cs) {
+            for (uint32_t i = 0; i < kTestValueCount; i++)
+            {
+                auto value = i;
+                cs.ReadWrite(value);
+            }
+        });
+    }
+    const auto* data = static_cast<const uint8_t*>(ms.GetData());
+    return std::vector<uint8_t>(data, data + ms.GetLength());
+}
+
+static uint64_t ReadTestChunk(std::vector<uint8_t>& file, bool deferChunks)
+{
+    MemoryStream ms(file.data(), file.size());
+    OrcaStream orca(ms, OrcaStream::Mode::READING, deferChunks);
+    uint64_t sum = 0;
+    orca.ReadWriteChunk(kTestChunkId, [&sum](OrcaStream::ChunkStream& cs) {
+        for (uint32_t i = 0; i < kTestValueCount; i++)
+        {
+            uint32_t value{};
+            cs.ReadWrite(value);
+            sum += value;
+        }
+    });
+    return sum;
+}
+
+TEST(OrcaStreamTest, chunks_round_trip)
+{
+    auto file = WriteTestFile();
+    constexpr uint64_t kExpectedSum = kTestValueCount * (kTestValueCount - 1) / 2;
+    ASSERT_EQ(ReadTestChunk(file, false), kExpectedSum);
+    ASSERT_EQ(ReadTestChunk(file, true), kExpectedSum);
+}
+
+TEST(OrcaStreamTest, chunk_inflating_to_another_length_throws)
+{
+    auto file = WriteTestFile();
+
+    // The chunk table claims less data than the chunk inflates to
+    uint64_t length{};
+    std::memcpy(&length, file.data() + kFirstChunkLengthOffset, sizeof(length));
+    ASSERT_EQ(length, kTestValueCount * sizeof(uint32_t));
+    length -= sizeof(uint32_t);
+    std::memcpy(file.data() + kFirstChunkLengthOffset, &length, sizeof(length));
+
+    ASSERT_THROW(ReadTestChunk(file, false), IOException);
+    ASSERT_THROW(ReadTestChunk(file, true), IOException);
+}
+
+TEST(OrcaStreamTest, chunks_are_one_gzip_stream)
+{
+    // Builds without the chunk index inflate all chunks as a single gzip stream
+    auto file = WriteTestFile();
+    uint64_t compressedSize{};
+    std::memcpy(&compressedSize, file.data() + kCompressedSizeOffset, sizeof(compressedSize));
+    ASSERT_LE(kChunkDataOffset + compressedSize, file.size());
+
+    auto data = Ungzip(file.data() + kChunkDataOffset, static_cast<size_t>(compressedSize));
+    ASSERT_EQ(data.size(), kTestValueCount * sizeof(uint32_t));
+    for (uint32_t i = 0; i < kTestValueCount; i++)
+    {
+        uint32_t value{};
+        std::memcpy(&value, data.data() + i * sizeof(uint32_t), sizeof(value));
+        ASSERT_EQ(value, i);
+    }
+}
+
+TEST(OrcaStreamTest, chunks_without_index_round_trip)
+{
+    // Files written before the chunk index was added are inflated as a whole
+    auto file = WriteTestFile();
+    uint32_t flags{};
+    std::memcpy(&flags, file.data() + kFlagsOffset, sizeof(flags));
+    ASSERT_EQ(flags, OrcaStream::FLAG_CHUNK_INDEX);
+    flags = 0;
+    std::memcpy(file.data() + kFlagsOffset, &flags, sizeof(flags));
+
+    constexpr uint64_t kExpectedSum = kTestValueCount * (kTestValueCount - 1) / 2;
+    ASSERT_EQ(ReadTestChunk(file, false), kExpectedSum);
+    ASSERT_EQ(ReadTestChunk(file, true), kExpectedSum);
+}
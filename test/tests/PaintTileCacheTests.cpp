@@ -0,0 +1,262 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/config/Config.h>
+#include <openrct2/interface/Viewport.h>
+#include <openrct2/paint/Paint.TileCache.h>
+#include <openrct2/paint/Paint.h>
+#include <openrct2/paint/tile_element/Paint.Surface.h>
+#include <openrct2/paint/tile_element/Paint.TileElement.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/TileElement.h>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class PaintTileCacheTest : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        // Paint structs are only created for images that are loaded
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = false;
+        _context = CreateContext();
+        ASSERT_TRUE(_context->Initialise());
+        ASSERT_TRUE(GetContext()->LoadParkFromFile(TestData::GetParkPath("bpb.sv6")));
+        GameLoadInit();
+    }
+
+    static void TearDownTestCase()
+    {
+        _context.reset();
+        gOpenRCT2NoGraphics = true;
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> PaintTileCacheTest::_context;
+
+static std::string DescribeAttached(const AttachedPaintStruct& attached)
+{
+    return "  attached " + std::to_string(attached.image_id.ToUInt32()) + " "
+        + std::to_string(attached.ColourImageId.ToUInt32()) + " " + std::to_string(attached.RelativePos.x) + ","
+        + std::to_string(attached.RelativePos.y) + " " + std::to_string(attached.IsMasked);
+}
+
+static std::string DescribeStruct(const PaintStruct& ps, bool isChild)
+{
+    const auto& bounds = ps.Bounds;
+    return std::string(isChild ? " child " : "parent ") + std::to_string(ps.image_id.ToUInt32()) + " "
+        + std::to_string(ps.ScreenPos.x) + "," + std::to_string(ps.ScreenPos.y) + " " + std::to_string(bounds.x) + ","
+        + std::to_string(bounds.y) + "," + std::to_string(bounds.z) + "-" + std::to_string(bounds.x_end) + ","
+        + std::to_string(bounds.y_end) + "," + std::to_string(bounds.z_end) + " " + std::to_string(ps.MapPos.x) + ","
+        + std::to_string(ps.MapPos.y) + " " + std::to_string(ps.QuadrantIndex) + " "
+        + std::to_string(static_cast<int32_t>(ps.InteractionItem)) + " "
+        + std::to_string(reinterpret_cast<uintptr_t>(ps.Element));
+}
+
+// Every paint struct of the session, in the order they are sorted and drawn in
+static std::vector<std::string> DescribeSession(const PaintSession& session)
+{
+    std::vector<std::string> result;
+    for (auto quadrant = session.QuadrantBackIndex; quadrant <= session.QuadrantFrontIndex; quadrant++)
+    {
+        for (const auto* ps = session.Quadrants[quadrant]; ps != nullptr; ps = ps->NextQuadrantEntry)
+        {
+            for (const auto* child = ps; child != nullptr; child = child->Children)
+            {
+                result.push_back(DescribeStruct(*child, child != ps));
+                for (const auto* attached = child->Attached; attached != nullptr; attached = attached->NextEntry)
+                {
+                    result.push_back(DescribeAttached(*attached));
+                }
+            }
+        }
+    }
+    for (const auto& rect : session.CulledImages)
+    {
+        result.push_back(
+            "culled " + std::to_string(rect.GetLeft()) + "," + std::to_string(rect.GetTop()) + "-"
+            + std::to_string(rect.GetRight()) + "," + std::to_string(rect.GetBottom()));
+    }
+    return result;
+}
+
+template<typename TSetup> static std::vector<std::string> PaintTile(uint8_t rotation, TSetup&& setup)
+{
+    // Large enough that nothing is clipped, so direct paints and replayed tiles keep the same structs
+    DrawPixelInfo dpi;
+    dpi.x = -(1 << 28);
+    dpi.y = -(1 << 28);
+    dpi.width = 1 << 29;
+    dpi.height = 1 << 29;
+
+    PaintSession* session = PaintSessionAlloc(dpi, 0, rotation);
+    setup(*session);
+    auto result = DescribeSession(*session);
+    PaintSessionFree(session);
+    return result;
+}
+
+TEST_F(PaintTileCacheTest, replayed_tiles_match_direct_paint)
+{
+    PaintTileCacheUpdate();
+    size_t numStructs = 0;
+    const auto mapSize = GetMapSizeUnits();
+    for (uint8_t rotation = 0; rotation < 4; rotation++)
+    {
+        for (int32_t y = kCoordsXYStep; y < mapSize.y; y += kCoordsXYStep)
+        {
+            for (int32_t x = kCoordsXYStep; x < mapSize.x; x += kCoordsXYStep)
+            {
+                const CoordsXY mapCoords{ x, y };
+                const auto expected = PaintTile(
+                    rotation, [&](PaintSession& session) { TileElementPaintSetup(session, mapCoords); });
+                numStructs += expected.size();
+
+                // Recorded and replayed at once, then replayed from the cache after the update
+                const auto recorded = PaintTile(
+                    rotation, [&](PaintSession& session) { PaintTileCacheSetup(session, mapCoords); });
+                PaintTileCacheUpdate();
+                const auto cached = PaintTile(
+                    rotation, [&](PaintSession& session) { PaintTileCacheSetup(session, mapCoords); });
+
+                ASSERT_EQ(recorded, expected) << "x: " << x << ", y: " << y << ", rotation: " << int32_t{ rotation };
+                ASSERT_EQ(cached, expected) << "x: " << x << ", y: " << y << ", rotation: " << int32_t{ rotation };
+            }
+        }
+    }
+    ASSERT_GT(numStructs, 0u);
+}
+
+// The columns of a frame centred on the park, painted the way viewports paint them
+static std::vector<std::vector<std::string>> PaintFrame(uint8_t rotation, ZoomLevel zoom = ZoomLevel{ 0 })
+{
+    const auto mapSize = GetMapSizeUnits();
+    const auto centre = Translate3DTo2DWithZ(rotation, CoordsXYZ{ mapSize.x / 2, mapSize.y / 2, 0 });
+    const auto columnWidth = zoom.ApplyTo(32);
+    const auto width = zoom.ApplyTo(2048);
+    const auto height = zoom.ApplyTo(1024);
+
+    std::vector<std::vector<std::string>> columns;
+    for (int32_t x = centre.x - width / 2; x < centre.x + width / 2; x += columnWidth)
+    {
+        DrawPixelInfo dpi;
+        dpi.x = x;
+        dpi.y = centre.y - height / 2;
+        dpi.width = columnWidth;
+        dpi.height = height;
+        dpi.zoom_level = zoom;
+
+        PaintSession* session = PaintSessionAlloc(dpi, 0, rotation);
+        session->MayCullImages = true;
+        EXPECT_EQ(PaintTileCacheIsUsable(*session), Config::Get().general.PaintTileCache);
+        PaintSessionGenerate(*session);
+        columns.push_back(DescribeSession(*session));
+        PaintSessionFree(session);
+    }
+    return columns;
+}
+
+TEST_F(PaintTileCacheTest, cached_frames_match_direct_frames)
+{
+    auto& general = Config::Get().general;
+    const auto paintTileCache = general.PaintTileCache;
+    for (const auto& zoom : { ZoomLevel{ 0 }, ZoomLevel{ 3 } })
+    {
+        for (uint8_t rotation = 0; rotation < 4; rotation++)
+        {
+            general.PaintTileCache = false;
+            const auto expected = PaintFrame(rotation, zoom);
+
+            // The first frame records the tiles, the second one replays them
+            general.PaintTileCache = true;
+            PaintTileCacheInvalidate();
+            PaintTileCacheUpdate();
+            const auto recorded = PaintFrame(rotation, zoom);
+            PaintTileCacheUpdate();
+            const auto replayed = PaintFrame(rotation, zoom);
+
+            ASSERT_EQ(recorded, expected) << "zoom: " << int32_t{ static_cast<int8_t>(zoom) }
+                                          << ", rotation: " << int32_t{ rotation };
+            ASSERT_EQ(replayed, expected) << "zoom: " << int32_t{ static_cast<int8_t>(zoom) }
+                                          << ", rotation: " << int32_t{ rotation };
+        }
+    }
+    general.PaintTileCache = paintTileCache;
+}
+
+TEST_F(PaintTileCacheTest, invalidated_tiles_paint_their_new_elements)
+{
+    const auto mapSize = GetMapSizeUnits();
+    const CoordsXY mapCoords = CoordsXY{ mapSize.x / 2, mapSize.y / 2 }.ToTileStart();
+    auto* surfaceElement = MapGetSurfaceElementAt(mapCoords);
+    ASSERT_NE(surfaceElement, nullptr);
+    const auto paint = [&](PaintSession& session) { PaintTileCacheSetup(session, mapCoords); };
+
+    PaintTileCacheInvalidate();
+    PaintTileCacheUpdate();
+    PaintTile(0, paint);
+    PaintTileCacheUpdate();
+    const auto before = PaintTile(0, paint);
+
+    // Raise the surface and invalidate the tile the way game actions do
+    surfaceElement->BaseHeight += 2;
+    surfaceElement->ClearanceHeight += 2;
+    MapInvalidateTileFull(mapCoords);
+    PaintTileCacheUpdate();
+    const auto expected = PaintTile(0, [&](PaintSession& session) { TileElementPaintSetup(session, mapCoords); });
+    const auto after = PaintTile(0, paint);
+    surfaceElement->BaseHeight -= 2;
+    surfaceElement->ClearanceHeight -= 2;
+    MapInvalidateTileFull(mapCoords);
+
+    ASSERT_NE(before, expected);
+    ASSERT_EQ(after, expected);
+}
+
+TEST_F(PaintTileCacheTest, culled_images_are_not_allocated)
+{
+    DrawPixelInfo dpi;
+    dpi.x = -(1 << 28);
+    dpi.y = -(1 << 28);
+    dpi.width = 1 << 29;
+    dpi.height = 1 << 29;
+    dpi.zoom_level = ZoomLevel{ 3 };
+
+    const auto imageId = ImageId(SPR_TERRAIN_SELECTION_CORNER);
+    const BoundBoxXYZ boundBox{ { 0, 0, 0 }, { 32, 32, 1 } };
+    PaintSession* session = PaintSessionAlloc(dpi, 0, 0);
+    session->SpritePosition = { 0, 0 };
+
+    // Sessions that are only used for hit tests paint everything
+    EXPECT_FALSE(PaintIsImageTooSmall(*session, imageId));
+
+    session->CullImages = true;
+    EXPECT_EQ(PaintAddImageAsParent(*session, imageId, { 0, 0, 0 }, boundBox), nullptr);
+    EXPECT_EQ(session->LastPS, nullptr);
+    EXPECT_EQ(session->CulledImages.size(), 1u);
+    EXPECT_EQ(DescribeSession(*session).size(), 1u);
+
+    session->CullImages = false;
+    EXPECT_NE(PaintAddImageAsParent(*session, imageId, { 0, 0, 0 }, boundBox), nullptr);
+    EXPECT_EQ(session->CulledImages.size(), 1u);
+    PaintSessionFree(session);
+}
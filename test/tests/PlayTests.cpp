@@ -20,9 +20,11 @@
 #include <openrct2/actions/ParkSetParameterAction.h>
 #include <openrct2/actions/RideSetPriceAction.h>
 #include <openrct2/actions/RideSetStatusAction.h>
+#include <openrct2/actions/StaffHireNewAction.h>
 #include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/entity/EntityTweener.h>
 #include <openrct2/entity/Peep.h>
+#include <openrct2/entity/Staff.h>
 #include <openrct2/object/ObjectManager.h>
 #include <openrct2/platform/Platform.h>
 #include <openrct2/ride/Ride.h>
@@ -195,3 +197,58 @@ TEST_F(PlayTests, CarRideWithOneCarOnlyAcceptsTwoGuests)
         gameStateUpdateLogic();
     }
 }
+
+TEST_F(PlayTests, IncrementalEntitiesChecksumMatchesFullRehash)
+{
+    // This test verifies that the incrementally maintained entity checksum stays identical
+    // to the checksum obtained by re-hashing every entity, after every tick of a park where
+    // guests, staff and vehicles are changed by their own updates and by each other.
+    std::string initStateFile = TestData::GetParkPath("small_park_with_ferris_wheel.sv6");
+
+    auto context = localStartGame(initStateFile);
+    ASSERT_NE(context.get(), nullptr);
+
+    auto& gameState = GetGameState();
+    execute<ParkSetParameterAction>(ParkParameter::Open);
+    execute<ParkSetEntranceFeeAction>(0);
+    gameState.Park.Flags |= PARK_FLAGS_UNLOCK_ALL_PRICES;
+
+    // Guests boarding and leaving the ferris wheel change the vehicles as well as themselves
+    auto rideManager = GetRideManager();
+    auto it = std::find_if(
+        rideManager.begin(), rideManager.end(), [](auto& ride) { return ride.type == RIDE_TYPE_FERRIS_WHEEL; });
+    ASSERT_NE(it, rideManager.end());
+    Ride& ferrisWheel = *it;
+    execute<RideSetStatusAction>(ferrisWheel.id, RideStatus::Open);
+    execute<RideSetPriceAction>(ferrisWheel.id, 0, true);
+    gameState.Cheats.IgnoreRideIntensity = true;
+
+    // Handymen sweep the litter the guests drop, mechanics fix the vehicles of the broken down ride
+    execute<StaffHireNewAction>(true, StaffType::Handyman, EntertainerCostume::Panda, STAFF_ORDERS_SWEEPING);
+    execute<StaffHireNewAction>(true, StaffType::Mechanic, EntertainerCostume::Panda, STAFF_ORDERS_FIX_RIDES);
+    execute<StaffHireNewAction>(true, StaffType::Entertainer, EntertainerCostume::Tiger, 0);
+
+    for (int i = 0; i < 10; i++)
+    {
+        Park::GenerateGuest();
+    }
+
+    for (int i = 0; i < 6000; i++)
+    {
+        if (i == 2000)
+        {
+            RidePrepareBreakdown(ferrisWheel, BREAKDOWN_VEHICLE_MALFUNCTION);
+        }
+        else if (i == 4000)
+        {
+            RidePrepareBreakdown(ferrisWheel, BREAKDOWN_SAFETY_CUT_OUT);
+        }
+
+        gameStateUpdateLogic();
+
+        auto incremental = GetAllEntitiesChecksum();
+        InvalidateAllEntitiesChecksum();
+        auto full = GetAllEntitiesChecksum();
+        ASSERT_EQ(incremental.raw, full.raw) << "tick: " << i;
+    }
+}
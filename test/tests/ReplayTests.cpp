@@ -18,8 +18,10 @@
 #include <openrct2/audio/AudioContext.h>
 #include <openrct2/core/File.h>
 #include <openrct2/core/FileScanner.h>
+#include <openrct2/core/FileSystem.hpp>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
+#include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/platform/Platform.h>
 #include <openrct2/ride/Ride.h>
 #include <string>
@@ -97,6 +99,100 @@ TEST_P(ReplayTests, RunReplay)
     ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
 }
 
+TEST_P(ReplayTests, SeekReplay)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    auto testData = GetParam();
+    auto replayFile = testData.filePath;
+
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    IReplayManager* replayManager = context->GetReplayManager();
+    ASSERT_NE(replayManager, nullptr);
+
+    bool startedReplay = replayManager->StartPlayback(replayFile);
+    ASSERT_TRUE(startedReplay);
+
+    ReplayRecordInfo info;
+    ASSERT_TRUE(replayManager->GetCurrentReplayInfo(info));
+
+    // Seek forward, then back to the start so the initial park has to be restored.
+    ASSERT_TRUE(replayManager->SeekToTick(info.Ticks / 2));
+    ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+    ASSERT_TRUE(replayManager->SeekToTick(0));
+
+    while (replayManager->IsReplaying())
+    {
+        gameStateUpdateLogic();
+        if (replayManager->IsPlaybackStateMismatching())
+            break;
+    }
+    ASSERT_FALSE(replayManager->IsReplaying());
+    ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+}
+
+TEST(ReplayKeyframeTests, SeekFromKeyframeMatchesPlayback)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    constexpr uint32_t kRecordTicks = 400;
+    constexpr uint32_t kKeyframeTicks = 100;
+    constexpr uint32_t kSeekTick = 250;
+    const auto replayFile = (fs::temp_directory_path() / "openrct2_replay_keyframe_test.parkrep").u8string();
+
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    GetContext()->LoadParkFromFile(TestData::GetParkPath("bpb.sv6"));
+    GameLoadInit();
+
+    // Record a replay with keyframes close enough together for the seek to restore one
+    IReplayManager* replayManager = context->GetReplayManager();
+    ASSERT_TRUE(replayManager->StartRecording(replayFile, kRecordTicks, IReplayManager::RecordType::NORMAL, kKeyframeTicks));
+    while (replayManager->IsRecording())
+    {
+        gameStateUpdateLogic();
+    }
+
+    // Play through to the tick and remember the state
+    ASSERT_TRUE(replayManager->StartPlayback(replayFile));
+    ReplayRecordInfo info;
+    ASSERT_TRUE(replayManager->GetCurrentReplayInfo(info));
+    ASSERT_GE(info.NumKeyframes, kSeekTick / kKeyframeTicks);
+
+    const auto targetTick = GetGameState().CurrentTicks + kSeekTick;
+    while (GetGameState().CurrentTicks < targetTick)
+    {
+        gameStateUpdateLogic();
+        ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+    }
+    const auto playedChecksum = GetAllEntitiesChecksum().ToString();
+    ASSERT_TRUE(replayManager->StopPlayback());
+
+    // Seeking forward skips to the keyframe before the tick
+    ASSERT_TRUE(replayManager->StartPlayback(replayFile));
+    ASSERT_TRUE(replayManager->SeekToTick(kSeekTick));
+    ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+    ASSERT_EQ(GetGameState().CurrentTicks, targetTick);
+    ASSERT_EQ(GetAllEntitiesChecksum().ToString(), playedChecksum);
+
+    // Seeking backward from a later tick restores the same keyframe
+    ASSERT_TRUE(replayManager->SeekToTick(kRecordTicks - 1));
+    ASSERT_TRUE(replayManager->SeekToTick(kSeekTick));
+    ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+    ASSERT_EQ(GetGameState().CurrentTicks, targetTick);
+    ASSERT_EQ(GetAllEntitiesChecksum().ToString(), playedChecksum);
+
+    replayManager->StopPlayback();
+    File::Delete(replayFile);
+}
+
 static void PrintTo(const ReplayTestData& testData, std::ostream* os)
 {
     *os << testData.filePath;
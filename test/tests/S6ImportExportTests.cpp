@@ -21,6 +21,7 @@
 #include <openrct2/audio/AudioContext.h>
 #include <openrct2/core/Crypt.h>
 #include <openrct2/core/File.h>
+#include <openrct2/core/FileSystem.hpp>
 #include <openrct2/core/MemoryStream.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
@@ -35,6 +36,7 @@
 #include <openrct2/scenario/Scenario.h>
 #include <openrct2/world/MapAnimation.h>
 #include <openrct2/world/Scenery.h>
+#include <optional>
 #include <stdio.h>
 #include <string>
 
@@ -278,6 +280,72 @@ TEST(S6ImportExportAdvanceTicks, all)
     SUCCEED();
 }
 
+TEST(S6ImportExportBackgroundSave, all)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    MemoryStream importBuffer;
+    MemoryStream exportBuffer;
+    MemoryStream snapshotStream;
+
+    const auto directory = fs::temp_directory_path() / "openrct2_background_save_test";
+    fs::remove_all(directory);
+    fs::create_directories(directory);
+    const auto savePath = (directory / "autosave.park").u8string();
+
+    // Load initial park data and save it on a background thread.
+    {
+        std::unique_ptr<IContext> context = CreateContext();
+        EXPECT_NE(context, nullptr);
+
+        bool initialised = context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        std::string testParkPath = TestData::GetParkPath("BigMapTest.sv6");
+        ASSERT_TRUE(LoadFileToBuffer(importBuffer, testParkPath));
+        ASSERT_TRUE(ImportS6(importBuffer, context, false));
+        AdvanceGameTicks(100, context);
+
+        std::optional<bool> saved;
+        // Saved with the flags of an autosave
+        ScenarioSaveAsync(GetGameState(), savePath, 0x80000000, [&saved](bool success) { saved = success; });
+        RecordGameStateSnapshot(context, snapshotStream);
+
+        // The game keeps running while the save is written
+        for (int i = 0; i < 1000 && !saved.has_value(); i++)
+        {
+            gameStateUpdateLogic();
+            ScenarioUpdatePendingSaves();
+            Platform::Sleep(1);
+        }
+        ScenarioFlushPendingSaves();
+        ASSERT_TRUE(saved.has_value());
+        ASSERT_TRUE(*saved);
+        ASSERT_FALSE(File::Exists(savePath + ".tmp"));
+    }
+
+    // Import the saved file.
+    {
+        std::unique_ptr<IContext> context = CreateContext();
+        EXPECT_NE(context, nullptr);
+
+        bool initialised = context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        ASSERT_TRUE(LoadFileToBuffer(exportBuffer, savePath));
+        ASSERT_TRUE(ImportPark(exportBuffer, context, true));
+
+        RecordGameStateSnapshot(context, snapshotStream);
+    }
+    fs::remove_all(directory);
+
+    snapshotStream.SetPosition(0);
+    CompareStates(importBuffer, exportBuffer, snapshotStream);
+
+    SUCCEED();
+}
+
 TEST(SeaDecrypt, DecryptSea)
 {
     auto path = TestData::GetParkPath("volcania.sea");
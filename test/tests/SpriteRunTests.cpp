@@ -0,0 +1,139 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/core/Imaging.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/drawing/ImageImporter.h>
+#include <openrct2/platform/Platform.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+using SpriteRunFunc = void (*)(const uint8_t*, uint8_t*, int32_t, const uint8_t*);
+
+class SpriteRunTest : public testing::Test
+{
+protected:
+    std::mt19937 _random{ 42 };
+    std::vector<uint8_t> _table = std::vector<uint8_t>(256);
+
+    void SetUp() override
+    {
+        // Some colours map to 0, those pixels must be left alone
+        for (auto& entry : _table)
+        {
+            entry = _random() % 8 == 0 ? 0 : static_cast<uint8_t>(_random());
+        }
+    }
+
+    std::vector<uint8_t> CreatePixels(size_t count, bool withTransparency)
+    {
+        std::vector<uint8_t> pixels(count);
+        for (auto& pixel : pixels)
+        {
+            pixel = withTransparency && _random() % 5 == 0 ? 0 : static_cast<uint8_t>(_random());
+        }
+        return pixels;
+    }
+
+    // Runs both functions on all run lengths up to a full RLE run, at every alignment of a 32 byte vector
+    void AssertSameAsScalar(SpriteRunFunc func, SpriteRunFunc scalar)
+    {
+        constexpr int32_t kPadding = 32;
+        for (int32_t count = 0; count <= 127; count++)
+        {
+            for (int32_t offset = 0; offset < 32; offset += 3)
+            {
+                const auto src = CreatePixels(count + kPadding * 2, true);
+                auto expected = CreatePixels(count + kPadding * 2, false);
+                auto actual = expected;
+
+                scalar(src.data() + offset, expected.data() + offset, count, _table.data());
+                func(src.data() + offset, actual.data() + offset, count, _table.data());
+                ASSERT_EQ(actual, expected) << "count: " << count << ", offset: " << offset;
+            }
+        }
+    }
+};
+
+TEST_F(SpriteRunTest, scalar_matches_blit_pixel)
+{
+    const PaletteMap paletteMap(_table.data(), 1, 256);
+    const auto src = CreatePixels(256, true);
+    const auto dst = CreatePixels(256, false);
+
+    auto expected = dst;
+    auto actual = dst;
+    for (size_t i = 0; i < src.size(); i++)
+    {
+        BlitPixel<BLEND_TRANSPARENT | BLEND_SRC>(&src[i], &expected[i], paletteMap);
+    }
+    RemapRunScalar(src.data(), actual.data(), static_cast<int32_t>(src.size()), _table.data());
+    ASSERT_EQ(actual, expected);
+
+    expected = dst;
+    actual = dst;
+    for (size_t i = 0; i < src.size(); i++)
+    {
+        BlitPixel<BLEND_TRANSPARENT | BLEND_DST>(&src[i], &expected[i], paletteMap);
+    }
+    FilterRunScalar(src.data(), actual.data(), static_cast<int32_t>(src.size()), _table.data());
+    ASSERT_EQ(actual, expected);
+}
+
+TEST_F(SpriteRunTest, avx2_matches_scalar)
+{
+    if (!Platform::AVX2Available())
+        GTEST_SKIP() << "AVX2 is not available";
+
+    AssertSameAsScalar(RemapRunAvx2, RemapRunScalar);
+    AssertSameAsScalar(FilterRunAvx2, FilterRunScalar);
+}
+
+TEST_F(SpriteRunTest, rle_sprite_matches_blit_pixel)
+{
+    constexpr int32_t kSize = 96;
+    Image image;
+    image.Width = kSize;
+    image.Height = kSize;
+    image.Depth = 8;
+    image.Stride = kSize;
+    image.Pixels = CreatePixels(kSize * kSize, true);
+    ImageImportMeta meta{};
+    meta.palette = Palette::KeepIndices;
+    const auto sprite = ImageImporter().Import(image, meta);
+
+    const PaletteMap paletteMap(_table.data(), 1, 256);
+    const auto dst = CreatePixels(kSize * kSize, false);
+    for (const auto blended : { false, true })
+    {
+        // Transparent pixels are not part of any run
+        auto expected = dst;
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            if (blended)
+                BlitPixel<BLEND_TRANSPARENT | BLEND_DST>(&image.Pixels[i], &expected[i], paletteMap);
+            else
+                BlitPixel<BLEND_TRANSPARENT | BLEND_SRC>(&image.Pixels[i], &expected[i], paletteMap);
+        }
+
+        auto actual = dst;
+        DrawPixelInfo dpi;
+        dpi.bits = actual.data();
+        dpi.width = kSize;
+        dpi.height = kSize;
+        const auto imageId = blended ? ImageId(0).WithBlended(true) : ImageId(0, COLOUR_BLACK);
+        const DrawSpriteArgs args(imageId, paletteMap, sprite.Element, 0, 0, kSize, kSize, actual.data());
+        GfxRleSpriteToBuffer(dpi, args);
+        ASSERT_EQ(actual, expected) << "blended: " << blended;
+    }
+}
@@ -0,0 +1,139 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/interface/ViewportInteractionBuffer.h>
+#include <openrct2/interface/Window.h>
+#include <openrct2/util/Util.h>
+
+static Viewport CreateViewport(ZoomLevel zoom, const ScreenCoordsXY& viewPos)
+{
+    Viewport viewport;
+    viewport.width = 64;
+    viewport.height = 48;
+    viewport.viewPos = viewPos;
+    viewport.zoom = zoom;
+    return viewport;
+}
+
+static InteractionInfo CreateInfo(ViewportInteractionItem type, int32_t x)
+{
+    InteractionInfo info;
+    info.Loc = { x, 0 };
+    info.SpriteType = type;
+    return info;
+}
+
+// Same as GetMapCoordinatesFromPosWindow
+static ScreenCoordsXY GetQueriedViewCoords(const Viewport& viewport, const ScreenCoordsXY& pixel)
+{
+    ScreenCoordsXY viewLoc = { viewport.zoom.ApplyTo(pixel.x), viewport.zoom.ApplyTo(pixel.y) };
+    viewLoc += viewport.viewPos;
+    if (viewport.zoom > ZoomLevel{ 0 })
+    {
+        viewLoc.x &= viewport.zoom.ApplyTo(0xFFFFFFFF) & 0xFFFFFFFF;
+        viewLoc.y &= viewport.zoom.ApplyTo(0xFFFFFFFF) & 0xFFFFFFFF;
+    }
+    return viewLoc;
+}
+
+TEST(ViewportInteractionBufferTest, pixels_map_to_queried_view_coords)
+{
+    for (int8_t zoom = -1; zoom <= 3; zoom++)
+    {
+        const auto viewport = CreateViewport(ZoomLevel{ zoom }, { -37, 21 });
+        ViewportInteractionBuffer buffer;
+        buffer.Prepare(viewport);
+
+        const auto columns = buffer.GetColumnRange(-20, 45);
+        for (int32_t column = 0; column < viewport.width; column++)
+        {
+            const auto expected = GetQueriedViewCoords(viewport, { column, 5 });
+            ASSERT_EQ(buffer.GetViewCoords(column, 5), expected);
+
+            const bool inRange = expected.x >= -20 && expected.x < 45;
+            ASSERT_EQ(column >= columns.first && column < columns.second, inRange);
+        }
+    }
+}
+
+TEST(ViewportInteractionBufferTest, unpainted_pixels_are_unknown)
+{
+    const auto viewport = CreateViewport(ZoomLevel{ 0 }, { 0, 0 });
+    ViewportInteractionBuffer buffer;
+    buffer.Prepare(viewport);
+    ASSERT_FALSE(buffer.Query(viewport, { 3, 4 }, ViewportInteractionItemAll).has_value());
+
+    buffer.Fill({ 0, 8 }, { 0, 8 }, ViewportInteractionBuffer::kNothing);
+    auto result = buffer.Query(viewport, { 3, 4 }, ViewportInteractionItemAll);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->SpriteType, ViewportInteractionItem::None);
+
+    // The viewport has changed since it was painted
+    auto zoomed = viewport;
+    zoomed.zoom = ZoomLevel{ 1 };
+    ASSERT_FALSE(buffer.Query(zoomed, { 3, 4 }, ViewportInteractionItemAll).has_value());
+}
+
+TEST(ViewportInteractionBufferTest, topmost_item_must_be_in_filter)
+{
+    const auto viewport = CreateViewport(ZoomLevel{ 0 }, { 0, 0 });
+    ViewportInteractionBuffer buffer;
+    buffer.Prepare(viewport);
+    buffer.Set(3, 4, buffer.AddEntry(CreateInfo(ViewportInteractionItem::Scenery, 96)));
+
+    auto result = buffer.Query(viewport, { 3, 4 }, EnumsToFlags(ViewportInteractionItem::Scenery));
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->Loc.x, 96);
+
+    // What is under the scenery is not known
+    ASSERT_FALSE(buffer.Query(viewport, { 3, 4 }, EnumsToFlags(ViewportInteractionItem::Terrain)).has_value());
+}
+
+TEST(ViewportInteractionBufferTest, pixels_move_when_scrolled)
+{
+    auto viewport = CreateViewport(ZoomLevel{ 1 }, { 0, 0 });
+    ViewportInteractionBuffer buffer;
+    buffer.Prepare(viewport);
+    buffer.Fill({ 0, viewport.width }, { 0, viewport.height }, ViewportInteractionBuffer::kNothing);
+    buffer.Set(10, 10, buffer.AddEntry(CreateInfo(ViewportInteractionItem::Wall, 32)));
+
+    // 8 view units are 4 pixels at this zoom level
+    viewport.viewPos = { 8, -8 };
+    buffer.Prepare(viewport);
+    auto result = buffer.Query(viewport, { 6, 14 }, ViewportInteractionItemAll);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->SpriteType, ViewportInteractionItem::Wall);
+
+    ASSERT_EQ(buffer.Get(viewport.width - 1, 20), ViewportInteractionBuffer::kUnknown);
+    ASSERT_EQ(buffer.Get(20, 0), ViewportInteractionBuffer::kUnknown);
+    ASSERT_EQ(buffer.Get(20, 20), ViewportInteractionBuffer::kNothing);
+}
+
+TEST(ViewportInteractionBufferTest, unreferenced_entries_are_removed)
+{
+    const auto viewport = CreateViewport(ZoomLevel{ 0 }, { 0, 0 });
+    ViewportInteractionBuffer buffer;
+    buffer.Prepare(viewport);
+
+    uint32_t entry = ViewportInteractionBuffer::kUnknown;
+    for (int32_t i = 0; i < 4096; i++)
+    {
+        entry = buffer.AddEntry(CreateInfo(ViewportInteractionItem::Footpath, i));
+    }
+    buffer.Set(1, 2, entry);
+    ASSERT_EQ(buffer.GetNumEntries(), 4096u);
+    ASSERT_EQ(buffer.AddEntry(CreateInfo(ViewportInteractionItem::Footpath, 0)), ViewportInteractionBuffer::kUnknown);
+
+    buffer.Prepare(viewport);
+    ASSERT_EQ(buffer.GetNumEntries(), 1u);
+    auto result = buffer.Query(viewport, { 1, 2 }, ViewportInteractionItemAll);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->Loc.x, 4095);
+}
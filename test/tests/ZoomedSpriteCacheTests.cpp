@@ -0,0 +1,157 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/core/Imaging.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/drawing/ImageImporter.h>
+#include <openrct2/drawing/ZoomedSpriteCache.h>
+#include <openrct2/sprites.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+class ZoomedSpriteCacheTest : public testing::Test
+{
+protected:
+    static constexpr int32_t kSize = 61;
+
+    std::mt19937 _random{ 7 };
+    Image _image;
+    ImageImporter::ImportResult _sprite;
+
+    void SetUp() override
+    {
+        _image.Width = kSize;
+        _image.Height = kSize;
+        _image.Depth = 8;
+        _image.Stride = kSize;
+        _image.Pixels.resize(kSize * kSize);
+        for (auto& pixel : _image.Pixels)
+        {
+            pixel = _random() % 4 == 0 ? 0 : static_cast<uint8_t>(_random());
+        }
+        ImageImportMeta meta{};
+        meta.palette = Palette::KeepIndices;
+        _sprite = ImageImporter().Import(_image, meta);
+    }
+
+    // Samples every zoom'th pixel from the clipped origin, like DrawRLESpriteMinify
+    std::vector<uint8_t> DrawExpected(
+        const std::vector<uint8_t>& dst, int32_t zoom, int32_t srcX, int32_t srcY, int32_t width, int32_t height)
+    {
+        const auto dstWidth = (kSize + zoom - 1) / zoom;
+        auto expected = dst;
+        for (int32_t i = 0; i < height; i += zoom)
+        {
+            for (int32_t x = 0; x < width; x += zoom)
+            {
+                const auto sourceX = srcX + x;
+                const auto pixel = sourceX < 0 ? 0 : _image.Pixels[(srcY + i) * kSize + sourceX];
+                if (pixel != 0)
+                {
+                    expected[(i / zoom) * dstWidth + x / zoom] = pixel;
+                }
+            }
+        }
+        return expected;
+    }
+
+    std::vector<uint8_t> Draw(
+        const std::vector<uint8_t>& dst, ImageIndex imageIndex, int32_t zoomLevel, int32_t srcX, int32_t srcY,
+        int32_t width, int32_t height)
+    {
+        const auto zoom = 1 << zoomLevel;
+        auto actual = dst;
+        DrawPixelInfo dpi;
+        dpi.bits = actual.data();
+        dpi.width = ((kSize + zoom - 1) / zoom) * zoom;
+        dpi.height = dpi.width;
+        dpi.zoom_level = ZoomLevel{ static_cast<int8_t>(zoomLevel) };
+        const DrawSpriteArgs args(
+            ImageId(imageIndex), PaletteMap::GetDefault(), _sprite.Element, srcX, srcY, width, height, actual.data());
+        GfxRleSpriteToBuffer(dpi, args);
+        return actual;
+    }
+};
+
+TEST_F(ZoomedSpriteCacheTest, zoomed_sprite_matches_minified_sprite)
+{
+    GetZoomedSpriteCache().Clear();
+    for (int32_t zoomLevel = 1; zoomLevel <= 3; zoomLevel++)
+    {
+        const auto zoom = 1 << zoomLevel;
+        const auto dstWidth = (kSize + zoom - 1) / zoom;
+        for (int32_t srcX = -zoom + 1; srcX < 2 * zoom; srcX++)
+        {
+            for (int32_t srcY = 0; srcY < 2 * zoom; srcY++)
+            {
+                std::vector<uint8_t> dst(dstWidth * dstWidth);
+                for (auto& pixel : dst)
+                {
+                    pixel = static_cast<uint8_t>(_random());
+                }
+
+                const auto width = kSize - std::max(srcX, 0) - 3;
+                const auto height = kSize - srcY - 1;
+                const auto expected = DrawExpected(dst, zoom, srcX, srcY, width, height);
+
+                // SPR_TEMP is never cached, so it takes the original path
+                ASSERT_EQ(Draw(dst, SPR_TEMP, zoomLevel, srcX, srcY, width, height), expected)
+                    << "zoom: " << zoom << ", srcX: " << srcX << ", srcY: " << srcY;
+                ASSERT_EQ(Draw(dst, SPR_IMAGE_LIST_BEGIN, zoomLevel, srcX, srcY, width, height), expected)
+                    << "zoom: " << zoom << ", srcX: " << srcX << ", srcY: " << srcY;
+            }
+        }
+    }
+    ASSERT_GT(GetZoomedSpriteCache().GetCount(), 0u);
+    GetZoomedSpriteCache().Clear();
+}
+
+TEST_F(ZoomedSpriteCacheTest, sprites_are_shared_until_invalidated)
+{
+    ZoomedSpriteCache cache;
+    const auto sprite = cache.Get(SPR_IMAGE_LIST_BEGIN, _sprite.Element, ZoomLevel{ 1 }, 0, 1);
+    ASSERT_NE(sprite, nullptr);
+    ASSERT_EQ(sprite->Element.width, kSize / 2 + 1);
+    ASSERT_EQ(sprite->Element.height, kSize / 2);
+    ASSERT_EQ(cache.Get(SPR_IMAGE_LIST_BEGIN, _sprite.Element, ZoomLevel{ 1 }, 0, 1), sprite);
+    ASSERT_NE(cache.Get(SPR_IMAGE_LIST_BEGIN, _sprite.Element, ZoomLevel{ 2 }, 0, 1), sprite);
+    ASSERT_EQ(cache.GetCount(), 2u);
+
+    cache.Invalidate(SPR_IMAGE_LIST_BEGIN);
+    ASSERT_EQ(cache.GetCount(), 0u);
+    ASSERT_EQ(cache.GetMemoryUsage(), 0u);
+
+    // Still usable by whoever is drawing it
+    ASSERT_EQ(sprite->Element.width, kSize / 2 + 1);
+    ASSERT_NE(cache.Get(SPR_IMAGE_LIST_BEGIN, _sprite.Element, ZoomLevel{ 1 }, 0, 1), sprite);
+
+    ASSERT_EQ(cache.Get(SPR_TEMP, _sprite.Element, ZoomLevel{ 1 }, 0, 0), nullptr);
+}
+
+TEST_F(ZoomedSpriteCacheTest, least_recently_used_sprites_are_dropped)
+{
+    const auto spriteSize = ZoomedSprite::Create(_sprite.Element, ZoomLevel{ 1 }, 0, 0)->GetMemoryUsage();
+    ZoomedSpriteCache cache(spriteSize * 4);
+    for (ImageIndex i = 0; i < 4; i++)
+    {
+        cache.Get(SPR_IMAGE_LIST_BEGIN + i, _sprite.Element, ZoomLevel{ 1 }, 0, 0);
+    }
+    ASSERT_EQ(cache.GetCount(), 4u);
+
+    // Using the first sprite again makes the second one the oldest
+    const auto first = cache.Get(SPR_IMAGE_LIST_BEGIN, _sprite.Element, ZoomLevel{ 1 }, 0, 0);
+    cache.Get(SPR_IMAGE_LIST_BEGIN + 4, _sprite.Element, ZoomLevel{ 1 }, 0, 0);
+    ASSERT_EQ(cache.GetCount(), 3u);
+    ASSERT_LE(cache.GetMemoryUsage(), spriteSize * 3);
+    ASSERT_EQ(cache.Get(SPR_IMAGE_LIST_BEGIN, _sprite.Element, ZoomLevel{ 1 }, 0, 0), first);
+}